@@ -0,0 +1,206 @@
+/***************************************************************************
+                            main.cpp  -  hgis-convert
+                              -------------------
+              begin                : 2025-08-31
+              copyright            : (C) 2025 HGIS Project
+              email                : support@hgis.org
+ ***************************************************************************/
+
+// 헤드리스 벡터 변환 도구 (좌표계 재투영 + 포맷 변환)
+//
+//   hgis-convert -t 5186 -o out.gpkg input.shp
+//   hgis-convert -s 5174 -t 5186 -j 8 -o converted/ 서울/*.shp 부산/*.shp
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QTextCodec>
+#include <QDebug>
+#include <cstdio>
+#include "core/HGISVectorConverter.h"
+
+namespace
+{
+bool verboseOutput = false;
+
+// 진행률 표시와 섞이지 않도록 상세 모드가 아니면 정보/디버그 로그 숨김
+void messageHandler(QtMsgType type, const QMessageLogContext &, const QString &message)
+{
+    if (!verboseOutput && (type == QtDebugMsg || type == QtInfoMsg)) {
+        return;
+    }
+    fprintf(stderr, "%s\n", message.toLocal8Bit().constData());
+}
+
+// "5186", "EPSG:5186" 또는 WKT
+HGISCoordinateReferenceSystem parseCrs(const QString &text)
+{
+    QString value = text.trimmed();
+    if (value.startsWith("EPSG:", Qt::CaseInsensitive)) {
+        value = value.mid(5);
+    }
+    
+    bool ok = false;
+    int epsg = value.toInt(&ok);
+    if (ok) {
+        return HGISCoordinateReferenceSystem(epsg);
+    }
+    return HGISCoordinateReferenceSystem(text);
+}
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    
+    // UTF-8 인코딩 설정
+    QTextCodec::setCodecForLocale(QTextCodec::codecForName("UTF-8"));
+    
+    app.setOrganizationName("HGIS");
+    app.setOrganizationDomain("hgis.org");
+    app.setApplicationName("hgis-convert");
+    app.setApplicationVersion("1.0.0");
+    
+    QCommandLineParser parser;
+    parser.setApplicationDescription("HGIS 벡터 데이터 일괄 변환 (좌표계 재투영 + 포맷 변환)");
+    parser.addHelpOption();
+    parser.addVersionOption();
+    parser.addPositionalArgument("inputs", "입력 파일 (여러 개 지정 가능)", "<input>...");
+    
+    QCommandLineOption outputOption({"o", "output"},
+        "출력 파일. 입력이 여러 개이면 출력 디렉터리", "path");
+    QCommandLineOption targetCrsOption({"t", "target-crs"},
+        "대상 좌표계 (예: 5186, EPSG:5186)", "crs");
+    QCommandLineOption sourceCrsOption({"s", "source-crs"},
+        "원본 좌표계 (지정하지 않으면 입력 파일의 좌표계)", "crs");
+    QCommandLineOption formatOption({"f", "format"},
+        "출력 OGR 드라이버 (예: GPKG, \"ESRI Shapefile\"). 기본값은 출력 확장자 기준", "driver");
+    QCommandLineOption jobsOption({"j", "jobs"},
+        "좌표 변환 작업 스레드 수 (기본값: CPU 코어 수)", "n", "0");
+    QCommandLineOption batchOption("batch-size",
+        "작업 스레드 하나가 처리하는 피처 수", "n", "4096");
+    QCommandLineOption transactionOption("transaction-size",
+        "트랜잭션당 피처 수", "n", "100000");
+    QCommandLineOption overwriteOption("overwrite", "기존 출력 파일 덮어쓰기");
+    QCommandLineOption quietOption({"q", "quiet"}, "진행률 표시 안 함");
+    QCommandLineOption verboseOption({"v", "verbose"}, "상세 로그 출력");
+    
+    parser.addOptions({outputOption, targetCrsOption, sourceCrsOption, formatOption,
+                       jobsOption, batchOption, transactionOption,
+                       overwriteOption, quietOption, verboseOption});
+    parser.process(app);
+    
+    verboseOutput = parser.isSet(verboseOption);
+    qInstallMessageHandler(messageHandler);
+    
+    const QStringList inputs = parser.positionalArguments();
+    if (inputs.isEmpty() || !parser.isSet(outputOption)) {
+        fprintf(stderr, "입력 파일과 출력 경로(-o)를 지정해야 합니다.\n\n");
+        parser.showHelp(1);
+    }
+    
+    HGISVectorConverter::Options options;
+    options.format = parser.value(formatOption);
+    options.threadCount = parser.value(jobsOption).toInt();
+    options.batchSize = parser.value(batchOption).toInt();
+    options.transactionSize = parser.value(transactionOption).toInt();
+    options.overwrite = parser.isSet(overwriteOption);
+    
+    if (parser.isSet(targetCrsOption)) {
+        options.targetCrs = parseCrs(parser.value(targetCrsOption));
+        if (!options.targetCrs.isValid()) {
+            fprintf(stderr, "대상 좌표계를 인식할 수 없습니다: %s\n",
+                    parser.value(targetCrsOption).toLocal8Bit().constData());
+            return 1;
+        }
+    }
+    if (parser.isSet(sourceCrsOption)) {
+        options.sourceCrs = parseCrs(parser.value(sourceCrsOption));
+        if (!options.sourceCrs.isValid()) {
+            fprintf(stderr, "원본 좌표계를 인식할 수 없습니다: %s\n",
+                    parser.value(sourceCrsOption).toLocal8Bit().constData());
+            return 1;
+        }
+    }
+    
+    // 입력이 여러 개이거나 출력이 디렉터리면 파일마다 같은 이름으로 출력
+    const QString outputPath = parser.value(outputOption);
+    const bool outputIsDirectory = inputs.size() > 1 || QFileInfo(outputPath).isDir();
+    if (outputIsDirectory && !QDir().mkpath(outputPath)) {
+        fprintf(stderr, "출력 디렉터리를 만들 수 없습니다: %s\n", outputPath.toLocal8Bit().constData());
+        return 1;
+    }
+    
+    const bool showProgress = !parser.isSet(quietOption);
+    HGISVectorConverter converter;
+    
+    QString currentName;
+    QElapsedTimer progressTimer;
+    QObject::connect(&converter, &HGISVectorConverter::progress,
+                     [&](long processed, long total, double featuresPerSecond) {
+        // 초당 몇 번만 갱신
+        if (!showProgress || (progressTimer.isValid() && progressTimer.elapsed() < 200 && processed < total)) {
+            return;
+        }
+        progressTimer.restart();
+        
+        double percent = total > 0 ? 100.0 * processed / total : 0.0;
+        fprintf(stderr, "\r%s: %ld / %ld (%.1f%%) %.0f 피처/초   ",
+                currentName.toLocal8Bit().constData(), processed, total, percent, featuresPerSecond);
+        fflush(stderr);
+    });
+    
+    int failed = 0;
+    long totalFeatures = 0;
+    QElapsedTimer totalTimer;
+    totalTimer.start();
+    
+    for (const QString &input : inputs) {
+        QFileInfo inputInfo(input);
+        QString output = outputPath;
+        if (outputIsDirectory) {
+            QString suffix = options.format.isEmpty() ? inputInfo.suffix() : QString();
+            if (suffix.isEmpty()) {
+                // 드라이버만 지정된 경우 대표 확장자 사용
+                suffix = (options.format == "ESRI Shapefile") ? "shp"
+                         : (options.format == "GeoJSON") ? "geojson"
+                         : "gpkg";
+            }
+            output = QDir(outputPath).filePath(inputInfo.completeBaseName() + "." + suffix);
+        }
+        
+        currentName = inputInfo.fileName();
+        progressTimer.invalidate();
+        
+        if (converter.convert(input, output, options)) {
+            totalFeatures += converter.featuresWritten();
+            if (showProgress) {
+                fprintf(stderr, "\r%s -> %s: %ld 피처, %.2f초 (%.0f 피처/초)",
+                        currentName.toLocal8Bit().constData(),
+                        output.toLocal8Bit().constData(),
+                        converter.featuresWritten(), converter.elapsedSeconds(),
+                        converter.elapsedSeconds() > 0 ? converter.featuresWritten() / converter.elapsedSeconds() : 0.0);
+                if (converter.transformFailures() > 0) {
+                    fprintf(stderr, " [좌표 변환 실패 %ld]", converter.transformFailures());
+                }
+                fprintf(stderr, "\n");
+            }
+        } else {
+            ++failed;
+            fprintf(stderr, "\n%s: 변환 실패 - %s\n",
+                    currentName.toLocal8Bit().constData(),
+                    converter.errorMessage().toLocal8Bit().constData());
+        }
+    }
+    
+    if (inputs.size() > 1 && showProgress) {
+        const double seconds = totalTimer.elapsed() / 1000.0;
+        fprintf(stderr, "전체: 파일 %d개 (실패 %d), %ld 피처, %.2f초 (%.0f 피처/초)\n",
+                inputs.size(), failed, totalFeatures, seconds,
+                seconds > 0 ? totalFeatures / seconds : 0.0);
+    }
+    
+    return failed > 0 ? 2 : 0;
+}
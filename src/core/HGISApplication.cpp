@@ -1,4 +1,5 @@
 #include "HGISApplication.h"
+#include "HGISCacheManager.h"
 #include <QDir>
 #include <QStandardPaths>
 #include <QDebug>
@@ -116,6 +117,14 @@ void HGISApplication::loadSettings()
             d->configPath = d->settings->value("ConfigPath").toString();
         }
         d->settings->endGroup();
+        
+        // 레이어 피처 캐시 메모리 예산 (MB, 없으면 물리 메모리 기준 기본값)
+        d->settings->beginGroup("Cache");
+        if (d->settings->contains("MemoryBudgetMB")) {
+            const qint64 megabytes = d->settings->value("MemoryBudgetMB").toLongLong();
+            HGISCacheManager::instance()->setMemoryBudget(megabytes * 1024 * 1024);
+        }
+        d->settings->endGroup();
     }
 }
 
@@ -127,6 +136,16 @@ void HGISApplication::saveSettings()
         d->settings->setValue("PluginPath", d->pluginPath);
         d->settings->setValue("ConfigPath", d->configPath);
         d->settings->endGroup();
+        
+        // 기본값이면 저장하지 않음 (메모리가 다른 PC에서 다시 계산)
+        const qint64 budget = HGISCacheManager::instance()->memoryBudget();
+        d->settings->beginGroup("Cache");
+        if (budget != HGISCacheManager::defaultMemoryBudget()) {
+            d->settings->setValue("MemoryBudgetMB", budget / (1024 * 1024));
+        } else {
+            d->settings->remove("MemoryBudgetMB");
+        }
+        d->settings->endGroup();
         d->settings->sync();
     }
 }
@@ -0,0 +1,524 @@
+#include "HGISAttributeIndex.h"
+#include "providers/HGISGdalProvider.h"
+#include <QDataStream>
+#include <QDateTime>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QPair>
+#include <QSaveFile>
+#include <ogr_api.h>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace
+{
+constexpr quint32 kIndexMagic = 0x48474958;    // "HGIX"
+constexpr quint32 kIndexVersion = 2;
+constexpr std::size_t kBuildBatchSize = 8192;
+
+// 원본 파일의 크기와 수정 시각 (Shapefile은 속성이 있는 .dbf 기준)
+void sourceStamp(const QString &datasetPath, qint64 &size, qint64 &modified)
+{
+    QFileInfo info(datasetPath);
+    if (info.suffix().compare("shp", Qt::CaseInsensitive) == 0) {
+        for (const QString &suffix : {QStringLiteral("dbf"), QStringLiteral("DBF")}) {
+            QFileInfo dbf(info.path() + '/' + info.completeBaseName() + '.' + suffix);
+            if (dbf.exists()) {
+                info = dbf;
+                break;
+            }
+        }
+    }
+    
+    size = info.exists() ? info.size() : -1;
+    modified = info.exists() ? info.lastModified().toMSecsSinceEpoch() : 0;
+}
+
+double normalizeNumber(double value)
+{
+    return value == 0.0 ? 0.0 : value;     // -0 과 +0 을 같은 키로
+}
+
+QString numberKey(double value)
+{
+    return QString::number(value, 'g', 17);
+}
+}
+
+class HGISAttributeIndex::Private
+{
+public:
+    QString fieldName;
+    Type type = HashIndex;
+    bool numeric = false;
+    bool valid = false;
+    QString errorMessage;
+    qint64 sourceSize = -1;
+    qint64 sourceModified = 0;
+    
+    std::vector<qint64> fids;                   // 값 순서 (같은 값은 FID 순)
+    std::vector<qint64> nullFids;               // 값이 NULL인 피처 (FID 순)
+    std::vector<double> numberKeys;             // 정렬 색인 키 (숫자 필드)
+    std::vector<QString> textKeys;              // 정렬 색인 키 (문자열 필드)
+    QHash<QString, QPair<int, int>> buckets;    // 해시 색인: 키 -> (시작, 개수)
+    
+    void clear()
+    {
+        valid = false;
+        fids.clear();
+        nullFids.clear();
+        numberKeys.clear();
+        textKeys.clear();
+        buckets.clear();
+    }
+    
+    // 정렬된 (키, FID) 쌍으로 색인 구조 채우기
+    template <typename Key, typename HashKey>
+    void assign(std::vector<std::pair<Key, qint64>> &entries, std::vector<Key> &keys, HashKey hashKeyOf)
+    {
+        std::sort(entries.begin(), entries.end());
+        
+        fids.resize(entries.size());
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            fids[i] = entries[i].second;
+        }
+        
+        if (type == SortedIndex) {
+            keys.resize(entries.size());
+            for (std::size_t i = 0; i < entries.size(); ++i) {
+                keys[i] = std::move(entries[i].first);
+            }
+            return;
+        }
+        
+        buckets.reserve(static_cast<int>(entries.size() / 2));
+        std::size_t begin = 0;
+        while (begin < entries.size()) {
+            std::size_t end = begin + 1;
+            while (end < entries.size() && entries[end].first == entries[begin].first) {
+                ++end;
+            }
+            buckets.insert(hashKeyOf(entries[begin].first),
+                           qMakePair(static_cast<int>(begin), static_cast<int>(end - begin)));
+            begin = end;
+        }
+    }
+    
+    QVector<long> fidsBetween(std::size_t begin, std::size_t end, bool sortResult) const
+    {
+        QVector<long> result;
+        result.reserve(static_cast<int>(end - begin));
+        for (std::size_t i = begin; i < end; ++i) {
+            result.append(static_cast<long>(fids[i]));
+        }
+        if (sortResult) {
+            std::sort(result.begin(), result.end());
+        }
+        return result;
+    }
+};
+
+HGISAttributeIndex::HGISAttributeIndex()
+    : d(std::make_unique<Private>())
+{
+}
+
+HGISAttributeIndex::~HGISAttributeIndex() = default;
+
+bool HGISAttributeIndex::build(const HGISGdalProvider &provider, const QString &fieldName, Type type)
+{
+    QElapsedTimer timer;
+    timer.start();
+    
+    d->clear();
+    d->fieldName = fieldName;
+    d->type = type;
+    
+    OGRLayerH layer = provider.layerHandle();
+    if (!layer) {
+        d->errorMessage = "데이터 소스가 열려 있지 않습니다";
+        return false;
+    }
+    
+    OGRFeatureDefnH defn = OGR_L_GetLayerDefn(layer);
+    const int fieldIndex = OGR_FD_GetFieldIndex(defn, fieldName.toUtf8().constData());
+    if (fieldIndex < 0) {
+        d->errorMessage = QString("필드를 찾을 수 없습니다: %1").arg(fieldName);
+        return false;
+    }
+    
+    const OGRFieldType fieldType = OGR_Fld_GetType(OGR_FD_GetFieldDefn(defn, fieldIndex));
+    d->numeric = (fieldType == OFTInteger || fieldType == OFTInteger64 || fieldType == OFTReal);
+    sourceStamp(provider.uri(), d->sourceSize, d->sourceModified);
+    
+    // 값과 FID만 모음 (NULL은 FID만 따로)
+    std::vector<std::pair<double, qint64>> numberEntries;
+    std::vector<std::pair<QString, qint64>> textEntries;
+    if (d->numeric) {
+        numberEntries.reserve(static_cast<std::size_t>(qMax(0L, provider.featureCount())));
+    } else {
+        textEntries.reserve(static_cast<std::size_t>(qMax(0L, provider.featureCount())));
+    }
+    
+    long read = provider.readFeatureBatches(kBuildBatchSize, [&](std::vector<OGRFeatureH> &batch) {
+        for (OGRFeatureH feature : batch) {
+            if (OGR_F_IsFieldSetAndNotNull(feature, fieldIndex)) {
+                const qint64 fid = OGR_F_GetFID(feature);
+                if (d->numeric) {
+                    numberEntries.emplace_back(normalizeNumber(OGR_F_GetFieldAsDouble(feature, fieldIndex)), fid);
+                } else {
+                    textEntries.emplace_back(QString::fromUtf8(OGR_F_GetFieldAsString(feature, fieldIndex)), fid);
+                }
+            } else {
+                d->nullFids.push_back(OGR_F_GetFID(feature));
+            }
+            OGR_F_Destroy(feature);
+        }
+        return true;
+    });
+    
+    if (read < 0) {
+        d->errorMessage = "피처를 읽을 수 없습니다";
+        return false;
+    }
+    
+    std::sort(d->nullFids.begin(), d->nullFids.end());
+    if (d->numeric) {
+        d->assign(numberEntries, d->numberKeys, numberKey);
+    } else {
+        d->assign(textEntries, d->textKeys, [](const QString &key) { return key; });
+    }
+    d->valid = true;
+    
+    qInfo() << "속성 색인 생성:" << fieldName
+            << (type == HashIndex ? "해시" : "정렬")
+            << "값 수:" << entryCount() << timer.elapsed() << "ms";
+    return true;
+}
+
+bool HGISAttributeIndex::save(const QString &path) const
+{
+    if (!d->valid) {
+        d->errorMessage = "저장할 색인이 없습니다";
+        return false;
+    }
+    
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        d->errorMessage = QString("색인 파일을 열 수 없습니다: %1").arg(file.errorString());
+        return false;
+    }
+    
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_6);
+    out << kIndexMagic << kIndexVersion
+        << d->fieldName << static_cast<qint32>(d->type) << d->numeric
+        << d->sourceSize << d->sourceModified
+        << static_cast<quint32>(d->fids.size());
+    
+    for (qint64 fid : d->fids) {
+        out << fid;
+    }
+    out << static_cast<quint32>(d->nullFids.size());
+    for (qint64 fid : d->nullFids) {
+        out << fid;
+    }
+    
+    if (d->type == SortedIndex) {
+        if (d->numeric) {
+            for (double key : d->numberKeys) {
+                out << key;
+            }
+        } else {
+            for (const QString &key : d->textKeys) {
+                out << key;
+            }
+        }
+    } else {
+        out << static_cast<quint32>(d->buckets.size());
+        for (auto it = d->buckets.constBegin(); it != d->buckets.constEnd(); ++it) {
+            out << it.key() << static_cast<qint32>(it.value().first) << static_cast<qint32>(it.value().second);
+        }
+    }
+    
+    if (out.status() != QDataStream::Ok || !file.commit()) {
+        d->errorMessage = QString("색인 파일 저장 실패: %1").arg(file.errorString());
+        return false;
+    }
+    return true;
+}
+
+bool HGISAttributeIndex::load(const QString &path)
+{
+    d->clear();
+    
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        d->errorMessage = QString("색인 파일을 열 수 없습니다: %1").arg(file.errorString());
+        return false;
+    }
+    
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_6);
+    
+    quint32 magic = 0;
+    quint32 version = 0;
+    in >> magic >> version;
+    if (magic != kIndexMagic || version != kIndexVersion) {
+        d->errorMessage = "색인 파일 형식이 올바르지 않습니다";
+        return false;
+    }
+    
+    // 항목 수는 파일에서 읽은 값이므로 남은 바이트로 담을 수 있는지 먼저 확인
+    // (손상되었거나 다른 파일이면 여는 동안 수 GB를 할당하지 않도록)
+    auto fits = [&file](quint64 items, quint64 bytesPerItem) {
+        const qint64 remaining = file.size() - file.pos();
+        return remaining >= 0 && items * bytesPerItem <= static_cast<quint64>(remaining);
+    };
+    auto corrupted = [this]() {
+        d->errorMessage = "색인 파일이 손상되었습니다";
+        d->clear();
+        return false;
+    };
+    
+    qint32 type = 0;
+    quint32 count = 0;
+    in >> d->fieldName >> type >> d->numeric >> d->sourceSize >> d->sourceModified >> count;
+    if (in.status() != QDataStream::Ok || (type != SortedIndex && type != HashIndex)) {
+        return corrupted();
+    }
+    d->type = static_cast<Type>(type);
+    
+    // FID는 8바이트, 정렬 색인의 키는 숫자 8바이트 / 문자열 최소 4바이트 (길이)
+    const quint64 keyBytes = d->type != SortedIndex ? 0 : (d->numeric ? 8 : 4);
+    if (!fits(count, 8 + keyBytes)) {
+        return corrupted();
+    }
+    d->fids.resize(count);
+    for (qint64 &fid : d->fids) {
+        in >> fid;
+    }
+    quint32 nullCount = 0;
+    in >> nullCount;
+    if (in.status() != QDataStream::Ok || !fits(nullCount, 8)) {
+        return corrupted();
+    }
+    d->nullFids.resize(nullCount);
+    for (qint64 &fid : d->nullFids) {
+        in >> fid;
+    }
+    
+    if (d->type == SortedIndex) {
+        if (d->numeric) {
+            d->numberKeys.resize(count);
+            for (double &key : d->numberKeys) {
+                in >> key;
+            }
+        } else {
+            d->textKeys.resize(count);
+            for (QString &key : d->textKeys) {
+                in >> key;
+            }
+        }
+    } else {
+        // 버킷 하나는 최소 12바이트 (키 길이 + 시작 + 길이)
+        quint32 bucketCount = 0;
+        in >> bucketCount;
+        if (in.status() != QDataStream::Ok || !fits(bucketCount, 12)) {
+            return corrupted();
+        }
+        d->buckets.reserve(static_cast<int>(bucketCount));
+        for (quint32 i = 0; i < bucketCount && in.status() == QDataStream::Ok; ++i) {
+            QString key;
+            qint32 begin = 0;
+            qint32 length = 0;
+            in >> key >> begin >> length;
+            if (begin < 0 || length < 0 || quint32(begin) + quint32(length) > count) {
+                return corrupted();
+            }
+            d->buckets.insert(key, qMakePair(begin, length));
+        }
+    }
+    
+    if (in.status() != QDataStream::Ok) {
+        return corrupted();
+    }
+    
+    d->valid = true;
+    return true;
+}
+
+bool HGISAttributeIndex::isUpToDate(const QString &datasetPath) const
+{
+    qint64 size = 0;
+    qint64 modified = 0;
+    sourceStamp(datasetPath, size, modified);
+    return d->valid && size == d->sourceSize && modified == d->sourceModified;
+}
+
+bool HGISAttributeIndex::isValid() const
+{
+    return d->valid;
+}
+
+QString HGISAttributeIndex::fieldName() const
+{
+    return d->fieldName;
+}
+
+HGISAttributeIndex::Type HGISAttributeIndex::type() const
+{
+    return d->type;
+}
+
+bool HGISAttributeIndex::isNumeric() const
+{
+    return d->numeric;
+}
+
+long HGISAttributeIndex::entryCount() const
+{
+    return static_cast<long>(d->fids.size());
+}
+
+long HGISAttributeIndex::nullCount() const
+{
+    return static_cast<long>(d->nullFids.size());
+}
+
+qint64 HGISAttributeIndex::memoryUsage() const
+{
+    qint64 bytes = static_cast<qint64>((d->fids.capacity() + d->nullFids.capacity()) * sizeof(qint64))
+                   + static_cast<qint64>(d->numberKeys.capacity() * sizeof(double));
+    for (const QString &key : d->textKeys) {
+        bytes += sizeof(QString) + 24 + key.capacity() * 2;
+    }
+    
+    // 해시 노드 (키 문자열 + 구간 + 노드 오버헤드)
+    for (auto it = d->buckets.constBegin(); it != d->buckets.constEnd(); ++it) {
+        bytes += 48 + it.key().capacity() * 2;
+    }
+    return bytes;
+}
+
+QString HGISAttributeIndex::errorMessage() const
+{
+    return d->errorMessage;
+}
+
+QVector<long> HGISAttributeIndex::find(const QVariant &value) const
+{
+    if (!d->valid || value.isNull()) {
+        return QVector<long>();
+    }
+    
+    double number = 0.0;
+    QString key;
+    if (d->numeric) {
+        bool ok = false;
+        number = normalizeNumber(value.toDouble(&ok));
+        if (!ok) {
+            return QVector<long>();
+        }
+        key = numberKey(number);
+    } else {
+        key = value.toString();
+    }
+    
+    if (d->type == HashIndex) {
+        auto it = d->buckets.constFind(key);
+        if (it == d->buckets.constEnd()) {
+            return QVector<long>();
+        }
+        return d->fidsBetween(it.value().first, it.value().first + it.value().second, false);
+    }
+    
+    // 같은 값 구간은 이미 FID 순
+    if (d->numeric) {
+        auto range = std::equal_range(d->numberKeys.begin(), d->numberKeys.end(), number);
+        return d->fidsBetween(range.first - d->numberKeys.begin(), range.second - d->numberKeys.begin(), false);
+    }
+    auto range = std::equal_range(d->textKeys.begin(), d->textKeys.end(), key);
+    return d->fidsBetween(range.first - d->textKeys.begin(), range.second - d->textKeys.begin(), false);
+}
+
+QVector<long> HGISAttributeIndex::findRange(const QVariant &minimum, const QVariant &maximum) const
+{
+    if (!d->valid || d->type != SortedIndex) {
+        return QVector<long>();
+    }
+    
+    std::size_t begin = 0;
+    std::size_t end = d->fids.size();
+    
+    if (d->numeric) {
+        bool ok = false;
+        if (minimum.isValid()) {
+            const double low = minimum.toDouble(&ok);
+            if (ok) {
+                begin = std::lower_bound(d->numberKeys.begin(), d->numberKeys.end(), low) - d->numberKeys.begin();
+            }
+        }
+        if (maximum.isValid()) {
+            const double high = maximum.toDouble(&ok);
+            if (ok) {
+                end = std::upper_bound(d->numberKeys.begin(), d->numberKeys.end(), high) - d->numberKeys.begin();
+            }
+        }
+    } else {
+        if (minimum.isValid()) {
+            begin = std::lower_bound(d->textKeys.begin(), d->textKeys.end(), minimum.toString()) - d->textKeys.begin();
+        }
+        if (maximum.isValid()) {
+            end = std::upper_bound(d->textKeys.begin(), d->textKeys.end(), maximum.toString()) - d->textKeys.begin();
+        }
+    }
+    
+    if (begin >= end) {
+        return QVector<long>();
+    }
+    return d->fidsBetween(begin, end, true);
+}
+
+QString HGISAttributeIndex::indexPath(const QString &datasetPath, const QString &fieldName)
+{
+    // 파일 이름에 쓸 수 없는 문자는 '_'로
+    QString safeName = fieldName;
+    for (QChar &ch : safeName) {
+        if (QStringLiteral("/\\:*?\"<>|").contains(ch)) {
+            ch = '_';
+        }
+    }
+    return datasetPath + '.' + safeName + ".hgisidx";
+}
+
+QVector<long> HGISAttributeIndex::orderedFeatureIds(bool descending) const
+{
+    QVector<long> result;
+    if (!d->valid) {
+        return result;
+    }
+    
+    // 색인 배열이 이미 값 순서이므로 정렬 없이 이어 붙이기만 함 (NULL은 오름차순에서 마지막)
+    result.reserve(static_cast<int>(d->fids.size() + d->nullFids.size()));
+    if (descending) {
+        for (auto it = d->nullFids.rbegin(); it != d->nullFids.rend(); ++it) {
+            result.append(static_cast<long>(*it));
+        }
+        for (auto it = d->fids.rbegin(); it != d->fids.rend(); ++it) {
+            result.append(static_cast<long>(*it));
+        }
+    } else {
+        for (qint64 fid : d->fids) {
+            result.append(static_cast<long>(fid));
+        }
+        for (qint64 fid : d->nullFids) {
+            result.append(static_cast<long>(fid));
+        }
+    }
+    return result;
+}
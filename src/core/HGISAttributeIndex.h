@@ -0,0 +1,71 @@
+#ifndef HGISATTRIBUTEINDEX_H
+#define HGISATTRIBUTEINDEX_H
+
+#include <QString>
+#include <QVariant>
+#include <QVector>
+#include <memory>
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+class HGISGdalProvider;
+
+// 필드 하나의 속성 색인
+// 모든 (값, FID) 쌍을 값 순서로 정렬해 두고, 같은 값의 FID는 연속 구간으로 묶음
+// - 해시 색인: 값 -> 구간 해시 테이블 (같음 검색 O(1))
+// - 정렬 색인: 정렬된 값 배열 이분 탐색 (같음 검색 O(log n), 범위 검색 지원)
+// 데이터 파일 옆에 <데이터 파일>.<필드>.hgisidx 로 저장하고, 원본의 크기/수정 시각이 바뀌면 무효
+class CORE_EXPORT HGISAttributeIndex
+{
+public:
+    enum Type {
+        HashIndex,
+        SortedIndex
+    };
+    
+    HGISAttributeIndex();
+    ~HGISAttributeIndex();
+    
+    // 제공자에서 필드 값을 스트리밍으로 읽어 생성
+    bool build(const HGISGdalProvider &provider, const QString &fieldName, Type type);
+    
+    // 저장/불러오기
+    bool save(const QString &path) const;
+    bool load(const QString &path);
+    
+    // 색인을 만든 뒤 원본 데이터가 바뀌지 않았는지
+    bool isUpToDate(const QString &datasetPath) const;
+    
+    bool isValid() const;
+    QString fieldName() const;
+    Type type() const;
+    bool isNumeric() const;
+    long entryCount() const;       // NULL이 아닌 값 수
+    long nullCount() const;        // NULL 값 수
+    qint64 memoryUsage() const;    // 메모리 사용량 추정 (바이트)
+    QString errorMessage() const;
+    
+    // 값이 같은 피처 ID (오름차순)
+    QVector<long> find(const QVariant &value) const;
+    
+    // minimum <= 값 <= maximum 인 피처 ID (정렬 색인만, 무효 QVariant는 열린 경계)
+    // 숫자 필드는 숫자 순서, 문자열 필드는 사전순
+    QVector<long> findRange(const QVariant &minimum, const QVariant &maximum) const;
+    
+    // 값 순서로 나열한 전체 피처 ID (속성 테이블 정렬용, NULL은 오름차순에서 마지막)
+    // 해시/정렬 색인 모두 가능
+    QVector<long> orderedFeatureIds(bool descending = false) const;
+    
+    // 데이터 파일에 대한 색인 파일 경로
+    static QString indexPath(const QString &datasetPath, const QString &fieldName);
+    
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+#endif // HGISATTRIBUTEINDEX_H
@@ -0,0 +1,291 @@
+#include "HGISAttributeJoin.h"
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QHash>
+#include <QTextCodec>
+#include <gdal.h>
+#include <ogr_api.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+// UTF-8로 읽고, 깨지면 CP949로 다시 해석 (한글 Excel에서 저장한 CSV)
+QString decodeText(const char *text)
+{
+    static QTextCodec *utf8 = QTextCodec::codecForName("UTF-8");
+    static QTextCodec *cp949 = QTextCodec::codecForName("CP949");
+    
+    const int length = static_cast<int>(qstrlen(text));
+    QTextCodec::ConverterState state;
+    const QString decoded = utf8->toUnicode(text, length, &state);
+    if (state.invalidChars == 0 || !cp949) {
+        return decoded;
+    }
+    return cp949->toUnicode(text, length);
+}
+
+QVariant fieldValue(OGRFeatureH feature, int index, OGRFieldType type)
+{
+    if (!OGR_F_IsFieldSetAndNotNull(feature, index)) {
+        return QVariant();
+    }
+    switch (type) {
+        case OFTInteger:
+            return OGR_F_GetFieldAsInteger(feature, index);
+        case OFTInteger64:
+            return static_cast<qlonglong>(OGR_F_GetFieldAsInteger64(feature, index));
+        case OFTReal:
+            return OGR_F_GetFieldAsDouble(feature, index);
+        default:
+            return decodeText(OGR_F_GetFieldAsString(feature, index));
+    }
+}
+}
+
+class HGISAttributeJoin::Private
+{
+public:
+    QString tablePath;
+    QString joinField;
+    QStringList fieldNames;
+    QString errorMessage;
+    bool valid = false;
+    long duplicates = 0;
+    
+    QHash<QString, int> rows;                   // 정규화한 키 -> 행
+    std::vector<std::vector<QVariant>> columns; // 필드 순서, 행 순서
+    
+    void clear()
+    {
+        valid = false;
+        duplicates = 0;
+        fieldNames.clear();
+        rows.clear();
+        columns.clear();
+    }
+};
+
+HGISAttributeJoin::HGISAttributeJoin()
+    : d(std::make_unique<Private>())
+{
+}
+
+HGISAttributeJoin::~HGISAttributeJoin() = default;
+
+bool HGISAttributeJoin::load(const QString &tablePath, const QString &joinField,
+                             const QStringList &fieldNames, const QString &layerName)
+{
+    QElapsedTimer timer;
+    timer.start();
+    
+    d->clear();
+    d->tablePath = tablePath;
+    d->joinField = joinField;
+    
+    if (GDALGetDriverCount() == 0) {
+        GDALAllRegister();
+    }
+    
+    // CSV는 모든 필드가 문자열로 읽히므로 타입 감지 (다른 드라이버에는 넘기지 않음)
+    const QString suffix = QFileInfo(tablePath).suffix().toLower();
+    const bool delimited = (suffix == "csv" || suffix == "tsv" || suffix == "txt");
+    const char *const csvOptions[] = {"AUTODETECT_TYPE=YES", "EMPTY_STRING_AS_NULL=YES", nullptr};
+    
+    GDALDatasetH dataset = GDALOpenEx(tablePath.toUtf8().constData(),
+                                      GDAL_OF_VECTOR | GDAL_OF_READONLY,
+                                      nullptr, delimited ? csvOptions : nullptr, nullptr);
+    if (!dataset) {
+        d->errorMessage = QString("표를 열 수 없습니다: %1").arg(tablePath);
+        qWarning() << d->errorMessage;
+        return false;
+    }
+    
+    OGRLayerH layer = layerName.isEmpty() ? GDALDatasetGetLayer(dataset, 0)
+                                          : GDALDatasetGetLayerByName(dataset, layerName.toUtf8().constData());
+    if (!layer) {
+        d->errorMessage = QString("시트/레이어를 찾을 수 없습니다: %1").arg(layerName);
+        qWarning() << d->errorMessage;
+        GDALClose(dataset);
+        return false;
+    }
+    
+    OGRFeatureDefnH defn = OGR_L_GetLayerDefn(layer);
+    const int keyIndex = OGR_FD_GetFieldIndex(defn, joinField.toUtf8().constData());
+    if (keyIndex < 0) {
+        d->errorMessage = QString("조인 필드를 찾을 수 없습니다: %1").arg(joinField);
+        qWarning() << d->errorMessage;
+        GDALClose(dataset);
+        return false;
+    }
+    
+    // 가져올 필드
+    std::vector<int> indexes;
+    std::vector<OGRFieldType> types;
+    const int fieldCount = OGR_FD_GetFieldCount(defn);
+    for (int i = 0; i < fieldCount; ++i) {
+        const QString name = QString::fromUtf8(OGR_Fld_GetNameRef(OGR_FD_GetFieldDefn(defn, i)));
+        if (fieldNames.isEmpty() ? i != keyIndex : fieldNames.contains(name)) {
+            d->fieldNames << name;
+            indexes.push_back(i);
+            types.push_back(OGR_Fld_GetType(OGR_FD_GetFieldDefn(defn, i)));
+        }
+    }
+    for (const QString &name : fieldNames) {
+        if (!d->fieldNames.contains(name)) {
+            qWarning() << "표에 없는 필드는 건너뜀:" << name;
+        }
+    }
+    
+    // 키와 가져올 필드 외에는 읽지 않음
+    QList<QByteArray> ignoredNames;
+    for (int i = 0; i < fieldCount; ++i) {
+        if (i != keyIndex && std::find(indexes.begin(), indexes.end(), i) == indexes.end()) {
+            ignoredNames.append(QByteArray(OGR_Fld_GetNameRef(OGR_FD_GetFieldDefn(defn, i))));
+        }
+    }
+    ignoredNames << "OGR_GEOMETRY" << "OGR_STYLE";
+    std::vector<const char *> ignored;
+    for (const QByteArray &name : ignoredNames) {
+        ignored.push_back(name.constData());
+    }
+    ignored.push_back(nullptr);
+    OGR_L_SetIgnoredFields(layer, ignored.data());
+    
+    const OGRFieldType keyType = OGR_Fld_GetType(OGR_FD_GetFieldDefn(defn, keyIndex));
+    const GIntBig expected = OGR_L_GetFeatureCount(layer, FALSE);
+    d->columns.assign(indexes.size(), std::vector<QVariant>());
+    if (expected > 0) {
+        d->rows.reserve(static_cast<int>(expected));
+        for (std::vector<QVariant> &column : d->columns) {
+            column.reserve(static_cast<std::size_t>(expected));
+        }
+    }
+    
+    long skipped = 0;
+    OGR_L_ResetReading(layer);
+    OGRFeatureH feature;
+    while ((feature = OGR_L_GetNextFeature(layer)) != nullptr) {
+        const QString key = normalizeKey(fieldValue(feature, keyIndex, keyType));
+        if (key.isEmpty()) {
+            ++skipped;
+        } else if (d->rows.contains(key)) {
+            ++d->duplicates;
+        } else {
+            d->rows.insert(key, d->rows.size());
+            for (std::size_t f = 0; f < indexes.size(); ++f) {
+                d->columns[f].push_back(fieldValue(feature, indexes[f], types[f]));
+            }
+        }
+        OGR_F_Destroy(feature);
+    }
+    GDALClose(dataset);
+    
+    d->valid = true;
+    qInfo() << "조인 표 읽기:" << QFileInfo(tablePath).fileName() << "키:" << joinField
+            << "행 수:" << d->rows.size() << "중복 키:" << d->duplicates << "빈 키:" << skipped
+            << timer.elapsed() << "ms";
+    return true;
+}
+
+bool HGISAttributeJoin::isValid() const
+{
+    return d->valid;
+}
+
+QString HGISAttributeJoin::tablePath() const
+{
+    return d->tablePath;
+}
+
+QString HGISAttributeJoin::joinField() const
+{
+    return d->joinField;
+}
+
+QStringList HGISAttributeJoin::fieldNames() const
+{
+    return d->fieldNames;
+}
+
+long HGISAttributeJoin::rowCount() const
+{
+    return d->rows.size();
+}
+
+long HGISAttributeJoin::duplicateKeyCount() const
+{
+    return d->duplicates;
+}
+
+qint64 HGISAttributeJoin::memoryUsage() const
+{
+    qint64 bytes = 0;
+    for (auto it = d->rows.constBegin(); it != d->rows.constEnd(); ++it) {
+        bytes += 48 + it.key().capacity() * 2;
+    }
+    for (const std::vector<QVariant> &column : d->columns) {
+        bytes += static_cast<qint64>(column.capacity() * sizeof(QVariant));
+        for (const QVariant &value : column) {
+            if (value.type() == QVariant::String) {
+                bytes += 24 + value.toString().capacity() * 2;
+            }
+        }
+    }
+    return bytes;
+}
+
+QString HGISAttributeJoin::errorMessage() const
+{
+    return d->errorMessage;
+}
+
+int HGISAttributeJoin::findRow(const QVariant &key) const
+{
+    const QString normalized = normalizeKey(key);
+    if (normalized.isEmpty()) {
+        return -1;
+    }
+    return d->rows.value(normalized, -1);
+}
+
+QVariant HGISAttributeJoin::value(int row, int fieldIndex) const
+{
+    if (fieldIndex < 0 || fieldIndex >= static_cast<int>(d->columns.size())
+        || row < 0 || row >= static_cast<int>(d->columns[fieldIndex].size())) {
+        return QVariant();
+    }
+    return d->columns[fieldIndex][row];
+}
+
+QVariant HGISAttributeJoin::value(const QVariant &key, const QString &fieldName) const
+{
+    return value(findRow(key), d->fieldNames.indexOf(fieldName));
+}
+
+QString HGISAttributeJoin::normalizeKey(const QVariant &key)
+{
+    if (!key.isValid() || key.isNull()) {
+        return QString();
+    }
+    
+    switch (key.type()) {
+        case QVariant::Int:
+        case QVariant::UInt:
+        case QVariant::LongLong:
+            return QString::number(key.toLongLong());
+        case QVariant::ULongLong:
+            return QString::number(key.toULongLong());
+        case QVariant::Double: {
+            const double number = key.toDouble();
+            if (std::floor(number) == number && std::fabs(number) < 9.0e15) {
+                return QString::number(static_cast<qint64>(number));
+            }
+            return QString::number(number, 'g', 17);
+        }
+        default:
+            return key.toString().trimmed().normalized(QString::NormalizationForm_C);
+    }
+}
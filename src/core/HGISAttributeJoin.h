@@ -0,0 +1,56 @@
+#ifndef HGISATTRIBUTEJOIN_H
+#define HGISATTRIBUTEJOIN_H
+
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <memory>
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+// 외부 속성 표 (CSV, XLSX 등 OGR로 열 수 있는 표)의 조인 키 해시 테이블
+// 표를 한 번 스트리밍으로 읽어 키 -> 행 해시와 필요한 필드 값 열만 보관
+// 대상 레이어는 복사하지 않고, 대상 피처의 키 값으로 조회할 때마다 찾음
+class CORE_EXPORT HGISAttributeJoin
+{
+public:
+    HGISAttributeJoin();
+    ~HGISAttributeJoin();
+    
+    // 표 읽기 (fieldNames가 비어 있으면 키 필드를 뺀 모든 필드, layerName이 비어 있으면 첫 시트/레이어)
+    // CSV는 필드 타입 자동 감지, UTF-8이 아닌 문자열은 CP949로 해석
+    bool load(const QString &tablePath, const QString &joinField,
+              const QStringList &fieldNames = QStringList(),
+              const QString &layerName = QString());
+    
+    bool isValid() const;
+    QString tablePath() const;
+    QString joinField() const;
+    QStringList fieldNames() const;
+    long rowCount() const;
+    long duplicateKeyCount() const;     // 같은 키가 다시 나온 행 수 (첫 행만 사용)
+    qint64 memoryUsage() const;         // 키 해시와 값 열의 메모리 사용량 추정 (바이트)
+    QString errorMessage() const;
+    
+    // 키에 해당하는 행 (없으면 -1)
+    int findRow(const QVariant &key) const;
+    
+    // 행의 필드 값 (fieldIndex는 fieldNames() 순서)
+    QVariant value(int row, int fieldIndex) const;
+    
+    // 키와 필드 이름으로 바로 조회 (없으면 무효 QVariant)
+    QVariant value(const QVariant &key, const QString &fieldName) const;
+    
+    // 조인 키 정규화 (앞뒤 공백 제거, NFC, 정수 값 실수는 정수 표기 - 12.0 과 "12" 가 같은 키)
+    static QString normalizeKey(const QVariant &key);
+    
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+#endif // HGISATTRIBUTEJOIN_H
@@ -0,0 +1,288 @@
+#include "HGISCacheManager.h"
+#include <QDebug>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+#include <algorithm>
+#include <limits>
+
+#if defined(Q_OS_WIN)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(Q_OS_UNIX)
+#include <unistd.h>
+#endif
+
+namespace
+{
+constexpr qint64 kMegabyte = 1024 * 1024;
+
+qint64 physicalMemory()
+{
+#if defined(Q_OS_WIN)
+    MEMORYSTATUSEX status;
+    status.dwLength = sizeof(status);
+    if (GlobalMemoryStatusEx(&status)) {
+        return static_cast<qint64>(status.ullTotalPhys);
+    }
+#elif defined(Q_OS_UNIX) && defined(_SC_PHYS_PAGES)
+    const long pages = sysconf(_SC_PHYS_PAGES);
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    if (pages > 0 && pageSize > 0) {
+        return static_cast<qint64>(pages) * pageSize;
+    }
+#endif
+    return 0;
+}
+}
+
+class HGISCacheManager::Private
+{
+public:
+    struct Entry {
+        QString name;
+        ReleaseFunction release;
+        HGISCacheUsage usage;
+        quint64 lastUsed = 0;
+        bool releasing = false;
+    };
+    
+    mutable QMutex mutex;
+    QHash<int, Entry> entries;
+    qint64 budget = 0;
+    qint64 total = 0;
+    quint64 clock = 0;
+    int nextId = 1;
+    
+    // 해제할 수 있는 가장 오래된 캐시 (없으면 -1)
+    int leastRecentlyUsed(int keepId, const QSet<int> &tried) const
+    {
+        int victim = -1;
+        quint64 oldest = std::numeric_limits<quint64>::max();
+        for (auto it = entries.constBegin(); it != entries.constEnd(); ++it) {
+            const Entry &entry = it.value();
+            if (it.key() == keepId || tried.contains(it.key()) || entry.releasing
+                || entry.usage.reloadableBytes() <= 0) {
+                continue;
+            }
+            if (entry.lastUsed < oldest) {
+                oldest = entry.lastUsed;
+                victim = it.key();
+            }
+        }
+        return victim;
+    }
+};
+
+HGISCacheManager* HGISCacheManager::instance()
+{
+    static HGISCacheManager *manager = new HGISCacheManager();
+    return manager;
+}
+
+HGISCacheManager::HGISCacheManager(QObject *parent)
+    : QObject(parent)
+    , d(std::make_unique<Private>())
+{
+    d->budget = defaultMemoryBudget();
+}
+
+HGISCacheManager::~HGISCacheManager() = default;
+
+qint64 HGISCacheManager::memoryBudget() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->budget;
+}
+
+void HGISCacheManager::setMemoryBudget(qint64 bytes)
+{
+    {
+        QMutexLocker locker(&d->mutex);
+        d->budget = qMax<qint64>(0, bytes);
+    }
+    qInfo() << "캐시 메모리 예산:" << (bytes > 0 ? QString("%1 MB").arg(bytes / kMegabyte) : QString("무제한"));
+    
+    if (bytes > 0) {
+        evict(bytes, -1);
+    }
+}
+
+qint64 HGISCacheManager::defaultMemoryBudget()
+{
+    const qint64 memory = physicalMemory();
+    if (memory <= 0) {
+        return 1024 * kMegabyte;
+    }
+    return qBound(256 * kMegabyte, memory / 4, 4096 * kMegabyte);
+}
+
+int HGISCacheManager::registerCache(const QString &name, const ReleaseFunction &release)
+{
+    QMutexLocker locker(&d->mutex);
+    const int id = d->nextId++;
+    Private::Entry entry;
+    entry.name = name;
+    entry.release = release;
+    entry.lastUsed = ++d->clock;
+    d->entries.insert(id, entry);
+    return id;
+}
+
+void HGISCacheManager::unregisterCache(int id)
+{
+    qint64 total = 0;
+    {
+        QMutexLocker locker(&d->mutex);
+        auto it = d->entries.find(id);
+        if (it == d->entries.end()) {
+            return;
+        }
+        d->total -= it->usage.total();
+        d->entries.erase(it);
+        total = d->total;
+    }
+    emit usageChanged(total);
+}
+
+void HGISCacheManager::setCacheName(int id, const QString &name)
+{
+    QMutexLocker locker(&d->mutex);
+    auto it = d->entries.find(id);
+    if (it != d->entries.end()) {
+        it->name = name;
+    }
+}
+
+void HGISCacheManager::updateUsage(int id, const HGISCacheUsage &usage)
+{
+    qint64 total = 0;
+    qint64 budget = 0;
+    {
+        QMutexLocker locker(&d->mutex);
+        auto it = d->entries.find(id);
+        if (it == d->entries.end()) {
+            return;
+        }
+        d->total += usage.total() - it->usage.total();
+        it->usage = usage;
+        it->lastUsed = ++d->clock;
+        total = d->total;
+        budget = d->budget;
+    }
+    emit usageChanged(total);
+    
+    // 방금 보고한 캐시는 사용 중이므로 남기고 다른 캐시부터 해제
+    if (budget > 0 && total > budget) {
+        evict(budget, id);
+    }
+}
+
+void HGISCacheManager::touch(int id)
+{
+    QMutexLocker locker(&d->mutex);
+    auto it = d->entries.find(id);
+    if (it != d->entries.end()) {
+        it->lastUsed = ++d->clock;
+    }
+}
+
+HGISCacheUsage HGISCacheManager::usage(int id) const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->entries.value(id).usage;
+}
+
+HGISCacheUsage HGISCacheManager::totalUsage() const
+{
+    QMutexLocker locker(&d->mutex);
+    HGISCacheUsage result;
+    for (const Private::Entry &entry : d->entries) {
+        result.geometryBytes += entry.usage.geometryBytes;
+        result.attributeBytes += entry.usage.attributeBytes;
+        result.indexBytes += entry.usage.indexBytes;
+    }
+    return result;
+}
+
+QVector<HGISCacheEntry> HGISCacheManager::entries() const
+{
+    QMutexLocker locker(&d->mutex);
+    QVector<HGISCacheEntry> result;
+    result.reserve(d->entries.size());
+    for (auto it = d->entries.constBegin(); it != d->entries.constEnd(); ++it) {
+        HGISCacheEntry entry;
+        entry.id = it.key();
+        entry.name = it->name;
+        entry.usage = it->usage;
+        entry.lastUsed = it->lastUsed;
+        result.append(entry);
+    }
+    
+    // 최근에 쓴 캐시가 먼저
+    std::sort(result.begin(), result.end(), [](const HGISCacheEntry &a, const HGISCacheEntry &b) {
+        return a.lastUsed > b.lastUsed;
+    });
+    return result;
+}
+
+qint64 HGISCacheManager::trim(qint64 targetBytes)
+{
+    return evict(qMax<qint64>(0, targetBytes), -1);
+}
+
+qint64 HGISCacheManager::evict(qint64 targetBytes, int keepId)
+{
+    qint64 released = 0;
+    QSet<int> tried;    // 해제해도 줄지 않는 캐시에서 멈추지 않도록 한 번씩만
+    
+    for (;;) {
+        int victim = -1;
+        QString name;
+        ReleaseFunction release;
+        qint64 before = 0;
+        {
+            QMutexLocker locker(&d->mutex);
+            if (d->total <= targetBytes) {
+                break;
+            }
+            victim = d->leastRecentlyUsed(keepId, tried);
+            if (victim < 0) {
+                break;
+            }
+            tried.insert(victim);
+            Private::Entry &entry = d->entries[victim];
+            entry.releasing = true;
+            name = entry.name;
+            release = entry.release;
+            before = entry.usage.total();
+        }
+        
+        // 콜백은 잠금 밖에서 호출 (레이어가 자기 잠금을 잡을 수 있음)
+        const HGISCacheUsage remaining = release ? release() : HGISCacheUsage();
+        
+        qint64 total = 0;
+        {
+            QMutexLocker locker(&d->mutex);
+            auto it = d->entries.find(victim);
+            if (it != d->entries.end()) {
+                d->total += remaining.total() - it->usage.total();
+                it->usage = remaining;
+                it->releasing = false;
+            }
+            total = d->total;
+        }
+        
+        const qint64 freed = qMax<qint64>(0, before - remaining.total());
+        released += freed;
+        qInfo() << "캐시 해제 (LRU):" << name << freed / kMegabyte << "MB"
+                << "사용량:" << total / kMegabyte << "MB";
+        emit cacheReleased(name, freed);
+        emit usageChanged(total);
+    }
+    
+    return released;
+}
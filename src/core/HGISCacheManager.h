@@ -0,0 +1,91 @@
+#ifndef HGISCACHEMANAGER_H
+#define HGISCACHEMANAGER_H
+
+#include <QObject>
+#include <QString>
+#include <QVector>
+#include <functional>
+#include <memory>
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+// 캐시 하나의 메모리 사용량 (추정, 바이트)
+struct HGISCacheUsage
+{
+    qint64 geometryBytes = 0;   // 좌표
+    qint64 attributeBytes = 0;  // 속성 값
+    qint64 indexBytes = 0;      // 속성 색인, FID 위치표, 조인 표 등
+    
+    qint64 total() const { return geometryBytes + attributeBytes + indexBytes; }
+    qint64 reloadableBytes() const { return geometryBytes + attributeBytes; }
+};
+
+// 캐시 항목 정보 (메모리 현황 표시용)
+struct HGISCacheEntry
+{
+    int id = -1;
+    QString name;
+    HGISCacheUsage usage;
+    quint64 lastUsed = 0;       // 클수록 최근에 사용
+};
+
+// 애플리케이션 전체의 레이어 피처 캐시 메모리 예산 관리
+// 레이어는 캐시를 등록하고 사용량을 보고하며, 합계가 예산을 넘으면 가장 오래 쓰지 않은
+// 레이어부터 해제 콜백을 불러 다시 읽을 수 있는 피처 캐시(좌표, 속성)를 비움
+// 색인 메모리는 합계에 포함하지만 해제 대상은 아님
+class CORE_EXPORT HGISCacheManager : public QObject
+{
+    Q_OBJECT
+    
+public:
+    // 해제 콜백 - 캐시를 비우고 남은 사용량을 반환 (콜백 안에서 관리자를 다시 호출하지 않음)
+    using ReleaseFunction = std::function<HGISCacheUsage()>;
+    
+    static HGISCacheManager* instance();
+    ~HGISCacheManager();
+    
+    // 메모리 예산 (바이트, 0이면 무제한)
+    qint64 memoryBudget() const;
+    void setMemoryBudget(qint64 bytes);
+    
+    // 물리 메모리의 1/4 (256MB ~ 4GB), 물리 메모리를 알 수 없으면 1GB
+    static qint64 defaultMemoryBudget();
+    
+    // 캐시 등록/해제 (반환한 ID로 이후 보고)
+    int registerCache(const QString &name, const ReleaseFunction &release);
+    void unregisterCache(int id);
+    void setCacheName(int id, const QString &name);
+    
+    // 사용량 보고 - 최근 사용으로 표시하고, 예산을 넘으면 다른 캐시부터 해제
+    void updateUsage(int id, const HGISCacheUsage &usage);
+    
+    // 최근 사용으로 표시만 함 (LRU 순서 갱신)
+    void touch(int id);
+    
+    // 사용량
+    HGISCacheUsage usage(int id) const;
+    HGISCacheUsage totalUsage() const;
+    QVector<HGISCacheEntry> entries() const;
+    
+    // 합계가 targetBytes 이하가 될 때까지 오래된 캐시 해제 (해제한 바이트 수)
+    qint64 trim(qint64 targetBytes);
+    
+signals:
+    void usageChanged(qint64 totalBytes);
+    void cacheReleased(const QString &name, qint64 releasedBytes);
+    
+private:
+    explicit HGISCacheManager(QObject *parent = nullptr);
+    
+    // 예산을 넘은 만큼 keepId를 뺀 캐시를 오래된 순서로 해제
+    qint64 evict(qint64 targetBytes, int keepId);
+    
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+#endif // HGISCACHEMANAGER_H
@@ -1,7 +1,109 @@
 #include "HGISCoordinateTransform.h"
+#include "HGISTransverseMercator.h"
+#include <QCache>
 #include <QDebug>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QPair>
+#include <QStringList>
 #include <proj.h>
+#include <algorithm>
 #include <cmath>
+#include <vector>
+
+namespace
+{
+// 근사 격자 분할 깊이 (최소 깊이까지는 오차와 관계없이 분할)
+constexpr int kApproxMinDepth = 2;
+constexpr int kApproxMaxDepth = 8;
+
+constexpr double kDegToRad = M_PI / 180.0;
+constexpr double kRadToDeg = 180.0 / M_PI;
+
+// 네이티브 TM 커널 검증 허용 오차 (1mm, 경위도는 약 1mm에 해당하는 1e-8도)
+constexpr double kNativeToleranceMeters = 1e-3;
+constexpr double kNativeToleranceDegrees = 1e-8;
+
+// 범위 변환 캐시 크기 (항목 수)
+constexpr int kBoundsCacheSize = 256;
+
+// 범위 변환 캐시 키: 좌표계 쌍 + 방향 + 사각형 + 밀도
+struct BoundsCacheKey {
+    QString source;
+    QString destination;
+    bool reverse;
+    int densifyPoints;
+    double x, y, width, height;
+    
+    bool operator==(const BoundsCacheKey &other) const
+    {
+        return reverse == other.reverse && densifyPoints == other.densifyPoints
+               && x == other.x && y == other.y
+               && width == other.width && height == other.height
+               && source == other.source && destination == other.destination;
+    }
+};
+
+uint qHash(const BoundsCacheKey &key, uint seed = 0)
+{
+    seed = ::qHash(key.source, seed);
+    seed = ::qHash(key.destination, seed);
+    seed = ::qHash(key.x, seed) ^ ::qHash(key.y, seed * 31);
+    seed = ::qHash(key.width, seed) ^ ::qHash(key.height, seed * 31);
+    return seed ^ ::qHash(key.densifyPoints * 2 + (key.reverse ? 1 : 0));
+}
+
+// 화면 갱신마다 같은 범위를 반복 변환하므로 프로세스 전역 LRU 캐시 사용
+QCache<BoundsCacheKey, QRectF> &boundsCache()
+{
+    static QCache<BoundsCacheKey, QRectF> cache(kBoundsCacheSize);
+    return cache;
+}
+
+QMutex &boundsCacheMutex()
+{
+    static QMutex mutex;
+    return mutex;
+}
+
+QString crsCacheKey(const HGISCoordinateReferenceSystem &crs)
+{
+    return crs.epsgCode() > 0 ? QString("EPSG:%1").arg(crs.epsgCode()) : crs.toWkt();
+}
+
+// 네이티브 TM 커널 검증 결과 (좌표계 쌍별로 한 번만 PROJ와 비교)
+// 변환 객체는 복사/대입할 때마다 다시 초기화되므로 검증을 반복하지 않도록 전역 보관
+QHash<QPair<QString, QString>, bool> &nativeValidationCache()
+{
+    static QHash<QPair<QString, QString>, bool> cache;
+    return cache;
+}
+
+QMutex &nativeValidationMutex()
+{
+    static QMutex mutex;
+    return mutex;
+}
+
+// PROJ 타원체 이름 -> (장반경, 역편평률)
+bool ellipsoidParameters(const QString &name, double &a, double &rf)
+{
+    if (name == "GRS80") {
+        a = 6378137.0;
+        rf = 298.257222101;
+    } else if (name == "WGS84") {
+        a = 6378137.0;
+        rf = 298.257223563;
+    } else if (name == "bessel") {
+        a = 6377397.155;
+        rf = 299.1528128;
+    } else {
+        return false;
+    }
+    return true;
+}
+}
 
 class HGISCoordinateTransform::Private
 {
@@ -13,6 +115,28 @@ public:
     QString lastError;
     bool valid = false;
     
+    // 근사 변환 격자 (쿼드트리)
+    // corners: 0=(left,top) 1=(right,top) 2=(left,bottom) 3=(right,bottom)
+    struct ApproxNode {
+        QRectF rect;
+        QPointF corners[4];
+        int firstChild = -1;    // 자식 4개가 연속 저장됨
+        bool exact = false;     // 허용 오차를 만족하지 못해 정밀 변환 사용
+    };
+    std::vector<ApproxNode> approxNodes;
+    QRectF approxExtent;
+    double approxTolerance = 0.0;
+    bool approximate = false;
+    
+    // 네이티브 TM 파이프라인
+    struct NativeStep {
+        enum Type { DegreesToRadians, RadiansToDegrees, Forward, Inverse };
+        Type type;
+        HGISTransverseMercator tm;
+    };
+    std::vector<NativeStep> nativeSteps;
+    bool nativeTm = false;
+    
     Private() = default;
     
     ~Private()
@@ -32,6 +156,17 @@ public:
         }
         valid = false;
         lastError.clear();
+        nativeSteps.clear();
+        nativeTm = false;
+        clearApproximation();
+    }
+    
+    void clearApproximation()
+    {
+        approxNodes.clear();
+        approxExtent = QRectF();
+        approxTolerance = 0.0;
+        approximate = false;
     }
     
     bool initialize()
@@ -85,6 +220,345 @@ public:
         }
         
         valid = true;
+        
+        // 파이프라인이 허용하면 네이티브 TM 커널 사용 (PROJ 대비 1mm 이내 검증 후)
+        nativeTm = buildNativePipeline() && nativePipelineValidated();
+        if (!nativeTm) {
+            nativeSteps.clear();
+        }
+        
+        return true;
+    }
+    
+    // PROJ 파이프라인 문자열을 해석해 단위 변환과 tmerc 단계로만 이루어졌는지 확인
+    bool buildNativePipeline()
+    {
+        nativeSteps.clear();
+        
+        const char *def = proj_as_proj_string(ctx, pj, PJ_PROJ_5, nullptr);
+        if (!def) {
+            return false;
+        }
+        
+        // "+step" 단위로 분리
+        QList<QStringList> steps;
+        steps.append(QStringList());
+        const QStringList tokens = QString::fromUtf8(def).split(' ', QString::SkipEmptyParts);
+        for (const QString &token : tokens) {
+            if (token == "+step") {
+                steps.append(QStringList());
+            } else {
+                steps.last().append(token);
+            }
+        }
+        
+        bool hasTmerc = false;
+        for (const QStringList &step : steps) {
+            QHash<QString, QString> params;
+            bool inverse = false;
+            for (const QString &token : step) {
+                if (token == "+inv") {
+                    inverse = true;
+                    continue;
+                }
+                QString key = token.mid(1).section('=', 0, 0);
+                params.insert(key, token.section('=', 1));
+            }
+            
+            const QString proj = params.take("proj");
+            params.remove("type");
+            params.remove("no_defs");
+            
+            if (proj.isEmpty() || proj == "pipeline" || proj == "noop") {
+                continue;
+            }
+            
+            if (proj == "unitconvert") {
+                const QString in = params.take("xy_in");
+                const QString out = params.take("xy_out");
+                if (!params.isEmpty()) {
+                    return false;
+                }
+                
+                bool degToRad = (in == "deg" && out == "rad");
+                bool radToDeg = (in == "rad" && out == "deg");
+                if (!degToRad && !radToDeg) {
+                    return false;
+                }
+                if (inverse) {
+                    std::swap(degToRad, radToDeg);
+                }
+                nativeSteps.push_back({degToRad ? NativeStep::DegreesToRadians
+                                                : NativeStep::RadiansToDegrees,
+                                       HGISTransverseMercator()});
+                continue;
+            }
+            
+            if (proj != "tmerc") {
+                return false;
+            }
+            
+            // 근사 알고리즘 (Evenden/Snyder) 이 지정된 경우 제외
+            if (params.contains("approx")
+                || (params.contains("algo") && params.value("algo") != "poder_engsager")) {
+                return false;
+            }
+            params.remove("algo");
+            
+            double a = 0.0;
+            double rf = 0.0;
+            if (params.contains("ellps")) {
+                if (!ellipsoidParameters(params.take("ellps"), a, rf)) {
+                    return false;
+                }
+            }
+            if (params.contains("a")) {
+                a = params.take("a").toDouble();
+            }
+            if (params.contains("rf")) {
+                rf = params.take("rf").toDouble();
+            }
+            
+            const double lat0 = params.take("lat_0").toDouble();
+            const double lon0 = params.take("lon_0").toDouble();
+            const double x0 = params.take("x_0").toDouble();
+            const double y0 = params.take("y_0").toDouble();
+            double k0 = 1.0;
+            if (params.contains("k")) {
+                k0 = params.take("k").toDouble();
+            }
+            if (params.contains("k_0")) {
+                k0 = params.take("k_0").toDouble();
+            }
+            if (params.contains("units") && params.take("units") != "m") {
+                return false;
+            }
+            
+            // 해석하지 못한 매개변수가 있으면 PROJ에 맡김
+            if (!params.isEmpty() || a <= 0.0 || rf <= 0.0) {
+                return false;
+            }
+            
+            HGISTransverseMercator tm(a, 1.0 / rf, lat0, lon0, k0, x0, y0);
+            if (!tm.isValid()) {
+                return false;
+            }
+            nativeSteps.push_back({inverse ? NativeStep::Inverse : NativeStep::Forward, tm});
+            hasTmerc = true;
+        }
+        
+        return hasTmerc;
+    }
+    
+    // 검증 결과를 좌표계 쌍별로 재사용 (처음 만드는 쌍만 PROJ와 비교)
+    bool nativePipelineValidated() const
+    {
+        const QPair<QString, QString> key(crsCacheKey(sourceCrs), crsCacheKey(destCrs));
+        {
+            QMutexLocker locker(&nativeValidationMutex());
+            auto it = nativeValidationCache().constFind(key);
+            if (it != nativeValidationCache().constEnd()) {
+                return it.value();
+            }
+        }
+        
+        const bool validated = validateNativePipeline();
+        QMutexLocker locker(&nativeValidationMutex());
+        nativeValidationCache().insert(key, validated);
+        return validated;
+    }
+    
+    // 네이티브 변환 (제자리) - 실패한 좌표는 PROJ와 같이 HUGE_VAL, 실패가 있으면 false
+    bool transformNative(double *x, double *y, std::size_t count, std::size_t stride, bool reverse) const
+    {
+        const int stepCount = static_cast<int>(nativeSteps.size());
+        for (int i = 0; i < stepCount; ++i) {
+            const NativeStep &step = nativeSteps[reverse ? stepCount - 1 - i : i];
+            
+            NativeStep::Type type = step.type;
+            if (reverse) {
+                switch (type) {
+                    case NativeStep::DegreesToRadians: type = NativeStep::RadiansToDegrees; break;
+                    case NativeStep::RadiansToDegrees: type = NativeStep::DegreesToRadians; break;
+                    case NativeStep::Forward: type = NativeStep::Inverse; break;
+                    case NativeStep::Inverse: type = NativeStep::Forward; break;
+                }
+            }
+            
+            switch (type) {
+                case NativeStep::DegreesToRadians:
+                case NativeStep::RadiansToDegrees: {
+                    const double factor = (type == NativeStep::DegreesToRadians) ? kDegToRad : kRadToDeg;
+                    for (std::size_t k = 0; k < count * stride; k += stride) {
+                        x[k] *= factor;
+                        y[k] *= factor;
+                    }
+                    break;
+                }
+                case NativeStep::Forward:
+                    step.tm.forward(x, y, count, stride);
+                    break;
+                case NativeStep::Inverse:
+                    step.tm.inverse(x, y, count, stride);
+                    break;
+            }
+        }
+        
+        // 정의역 밖 (HUGE_VAL) 이나 발산 (NaN) 한 좌표를 두 축 모두 HUGE_VAL로 표시
+        bool ok = true;
+        for (std::size_t k = 0; k < count * stride; k += stride) {
+            if (!std::isfinite(x[k]) || !std::isfinite(y[k])) {
+                x[k] = y[k] = HUGE_VAL;
+                ok = false;
+            }
+        }
+        return ok;
+    }
+    
+    // 사용 범위 격자에서 네이티브 결과를 PROJ 결과와 비교
+    bool validateNativePipeline() const
+    {
+        if (nativeSteps.empty()) {
+            return false;
+        }
+        
+        double west = 124.0, south = 33.0, east = 132.0, north = 43.0;
+        double w, s, e, n;
+        if (proj_get_area_of_use(ctx, pj, &w, &s, &e, &n, nullptr) && w < e && s < n) {
+            west = w;
+            south = s;
+            east = e;
+            north = n;
+        }
+        
+        // 입력 영역의 표본 (투영 좌표가 입력이면 첫 단계의 정방향으로 생성)
+        std::vector<QPointF> samples;
+        const int steps = 6;
+        for (int i = 0; i <= steps; ++i) {
+            for (int j = 0; j <= steps; ++j) {
+                double lon = west + (east - west) * i / steps;
+                double lat = south + (north - south) * j / steps;
+                if (nativeSteps.front().type == NativeStep::Inverse) {
+                    double px, py;
+                    nativeSteps.front().tm.forward(lon * kDegToRad, lat * kDegToRad, px, py);
+                    samples.push_back(QPointF(px, py));
+                } else if (nativeSteps.front().type == NativeStep::DegreesToRadians) {
+                    samples.push_back(QPointF(lon, lat));
+                } else {
+                    samples.push_back(QPointF(lon * kDegToRad, lat * kDegToRad));
+                }
+            }
+        }
+        
+        const NativeStep::Type last = nativeSteps.back().type;
+        const double tolerance = (last == NativeStep::Forward) ? kNativeToleranceMeters
+                                 : (last == NativeStep::RadiansToDegrees) ? kNativeToleranceDegrees
+                                 : kNativeToleranceDegrees * kDegToRad;
+        
+        std::vector<QPointF> native = samples;
+        transformNative(&native.front().rx(), &native.front().ry(), native.size(), 2, false);
+        
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            QPointF exact;
+            if (!transformExact(samples[i].x(), samples[i].y(), exact)) {
+                continue;
+            }
+            if (native[i].x() == HUGE_VAL || std::abs(exact.x() - native[i].x()) > tolerance
+                || std::abs(exact.y() - native[i].y()) > tolerance) {
+                qWarning() << "네이티브 TM 커널 검증 실패, PROJ 사용:"
+                           << samples[i] << exact << native[i];
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    // 사각형 경계를 따라 조밀하게 샘플링해 변환한 외접 사각형
+    // 곡선 투영에서 9점 샘플링은 범위를 과소 추정하므로 각 변마다 densifyPoints개의 점을 추가
+    QRectF transformBounds(const QRectF &rect, bool reverse, int densifyPoints) const
+    {
+        const double left = rect.left();
+        const double right = rect.right();
+        const double bottom = qMin(rect.top(), rect.bottom());
+        const double top = qMax(rect.top(), rect.bottom());
+        
+#if PROJ_VERSION_MAJOR > 8 || (PROJ_VERSION_MAJOR == 8 && PROJ_VERSION_MINOR >= 2)
+        // PROJ 8.2 이상: 날짜변경선과 극 처리가 포함된 proj_trans_bounds 사용
+        // (근사/네이티브 모드와 관계없이 PROJ 정밀 변환 기준)
+        double xmin, ymin, xmax, ymax;
+        if (proj_trans_bounds(ctx, pj, reverse ? PJ_INV : PJ_FWD,
+                              left, bottom, right, top,
+                              &xmin, &ymin, &xmax, &ymax, densifyPoints)) {
+            return QRectF(QPointF(xmin, ymin), QPointF(xmax, ymax));
+        }
+#endif
+        
+        // 네 변을 따라 모서리 포함 (densifyPoints + 1)개 구간으로 샘플링
+        const int segments = densifyPoints + 1;
+        std::vector<double> xs;
+        std::vector<double> ys;
+        xs.reserve(segments * 4);
+        ys.reserve(segments * 4);
+        for (int i = 0; i < segments; ++i) {
+            const double t = static_cast<double>(i) / segments;
+            const double dx = (right - left) * t;
+            const double dy = (top - bottom) * t;
+            
+            xs.push_back(left + dx);    // 아래 변
+            ys.push_back(bottom);
+            xs.push_back(right);        // 오른쪽 변
+            ys.push_back(bottom + dy);
+            xs.push_back(right - dx);   // 위 변
+            ys.push_back(top);
+            xs.push_back(left);         // 왼쪽 변
+            ys.push_back(top - dy);
+        }
+        
+        // 범위 계산에는 근사 격자를 쓰지 않음
+        const std::size_t count = xs.size();
+        if (nativeTm) {
+            transformNative(xs.data(), ys.data(), count, 1, reverse);
+        } else {
+            proj_trans_generic(pj, reverse ? PJ_INV : PJ_FWD,
+                               xs.data(), sizeof(double), count,
+                               ys.data(), sizeof(double), count,
+                               nullptr, 0, 0,
+                               nullptr, 0, 0);
+        }
+        
+        double minX = HUGE_VAL, minY = HUGE_VAL;
+        double maxX = -HUGE_VAL, maxY = -HUGE_VAL;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (xs[i] == HUGE_VAL || ys[i] == HUGE_VAL) {
+                continue;
+            }
+            minX = qMin(minX, xs[i]);
+            maxX = qMax(maxX, xs[i]);
+            minY = qMin(minY, ys[i]);
+            maxY = qMax(maxY, ys[i]);
+        }
+        
+        if (minX > maxX || minY > maxY) {
+            return QRectF();
+        }
+        return QRectF(QPointF(minX, minY), QPointF(maxX, maxY));
+    }
+    
+    // PROJ 정밀 변환 (실패 시 false)
+    bool transformExact(double x, double y, QPointF &out, bool reverse = false) const
+    {
+        PJ_COORD coord;
+        coord.xy.x = x;
+        coord.xy.y = y;
+        
+        PJ_COORD result = proj_trans(pj, reverse ? PJ_INV : PJ_FWD, coord);
+        
+        if (result.xy.x == HUGE_VAL || result.xy.y == HUGE_VAL) {
+            return false;
+        }
+        
+        out = QPointF(result.xy.x, result.xy.y);
         return true;
     }
     
@@ -103,24 +577,160 @@ public:
             return QPointF(x, y);
         }
         
-        PJ_COORD coord;
-        coord.xy.x = x;
-        coord.xy.y = y;
+        // 근사 격자 내부라면 보간으로 처리
+        QPointF result;
+        if (!reverse && approximate && interpolate(x, y, result)) {
+            return result;
+        }
         
-        PJ_COORD result;
-        if (reverse) {
-            result = proj_trans(pj, PJ_INV, coord);
-        } else {
-            result = proj_trans(pj, PJ_FWD, coord);
+        if (nativeTm) {
+            double nx = x;
+            double ny = y;
+            if (!transformNative(&nx, &ny, 1, 1, reverse)) {
+                qWarning() << "좌표 변환 실패:" << x << y;
+                return QPointF(x, y);
+            }
+            return QPointF(nx, ny);
         }
         
         // 변환 실패 체크
-        if (result.xy.x == HUGE_VAL || result.xy.y == HUGE_VAL) {
+        if (!transformExact(x, y, result, reverse)) {
             qWarning() << "좌표 변환 실패:" << x << y;
             return QPointF(x, y);
         }
         
-        return QPointF(result.xy.x, result.xy.y);
+        return result;
+    }
+    
+    static QPointF bilinear(const ApproxNode &node, double x, double y)
+    {
+        double u = (x - node.rect.left()) / node.rect.width();
+        double v = (y - node.rect.top()) / node.rect.height();
+        
+        QPointF top = node.corners[0] + (node.corners[1] - node.corners[0]) * u;
+        QPointF bottom = node.corners[2] + (node.corners[3] - node.corners[2]) * u;
+        return top + (bottom - top) * v;
+    }
+    
+    static double distance(const QPointF &a, const QPointF &b)
+    {
+        return std::hypot(a.x() - b.x(), a.y() - b.y());
+    }
+    
+    // 격자 셀 하나를 검사하고 오차가 크면 4분할
+    // 중심점과 변 중점 5개를 정밀 변환해 보간값과 비교한다
+    void buildNode(int index, int depth)
+    {
+        const QRectF rect = approxNodes[index].rect;
+        const double cx = rect.center().x();
+        const double cy = rect.center().y();
+        
+        const double sx[5] = {cx, cx, rect.left(), rect.right(), cx};
+        const double sy[5] = {rect.top(), rect.bottom(), cy, cy, cy};
+        QPointF exact[5];
+        
+        bool ok = true;
+        double maxError = 0.0;
+        for (int i = 0; i < 5 && ok; ++i) {
+            ok = transformExact(sx[i], sy[i], exact[i]);
+            if (ok) {
+                maxError = qMax(maxError, distance(exact[i], bilinear(approxNodes[index], sx[i], sy[i])));
+            }
+        }
+        
+        bool accurate = ok && maxError <= approxTolerance;
+        if (depth >= kApproxMinDepth && accurate) {
+            return;
+        }
+        
+        if (!ok || depth >= kApproxMaxDepth) {
+            // 변환 불가 또는 최대 깊이 도달 - 이 셀은 정밀 변환으로 처리
+            approxNodes[index].exact = !accurate;
+            return;
+        }
+        
+        // 자식 모서리: 상단 중점(0), 하단 중점(1), 좌측 중점(2), 우측 중점(3), 중심(4)
+        const ApproxNode parent = approxNodes[index];
+        const QPointF children[4][4] = {
+            {parent.corners[0], exact[0], exact[2], exact[4]},
+            {exact[0], parent.corners[1], exact[4], exact[3]},
+            {exact[2], exact[4], parent.corners[2], exact[1]},
+            {exact[4], exact[3], exact[1], parent.corners[3]}
+        };
+        const QRectF childRects[4] = {
+            QRectF(QPointF(rect.left(), rect.top()), QPointF(cx, cy)),
+            QRectF(QPointF(cx, rect.top()), QPointF(rect.right(), cy)),
+            QRectF(QPointF(rect.left(), cy), QPointF(cx, rect.bottom())),
+            QRectF(QPointF(cx, cy), QPointF(rect.right(), rect.bottom()))
+        };
+        
+        int first = static_cast<int>(approxNodes.size());
+        approxNodes[index].firstChild = first;
+        for (int i = 0; i < 4; ++i) {
+            ApproxNode child;
+            child.rect = childRects[i];
+            std::copy(children[i], children[i] + 4, child.corners);
+            approxNodes.push_back(child);
+        }
+        
+        for (int i = 0; i < 4; ++i) {
+            buildNode(first + i, depth + 1);
+        }
+    }
+    
+    bool buildApproximation(const QRectF &extent, double tolerance)
+    {
+        clearApproximation();
+        
+        if (!valid || !pj || extent.isEmpty() || tolerance <= 0.0) {
+            return false;
+        }
+        
+        ApproxNode root;
+        root.rect = extent.normalized();
+        const QPointF cornerPoints[4] = {
+            QPointF(root.rect.left(), root.rect.top()),
+            QPointF(root.rect.right(), root.rect.top()),
+            QPointF(root.rect.left(), root.rect.bottom()),
+            QPointF(root.rect.right(), root.rect.bottom())
+        };
+        for (int i = 0; i < 4; ++i) {
+            if (!transformExact(cornerPoints[i].x(), cornerPoints[i].y(), root.corners[i])) {
+                lastError = "근사 변환 격자를 만들 수 없습니다 (범위 모서리 변환 실패)";
+                return false;
+            }
+        }
+        
+        approxTolerance = tolerance;
+        approxNodes.reserve(64);
+        approxNodes.push_back(root);
+        buildNode(0, 0);
+        
+        approxExtent = root.rect;
+        approximate = true;
+        return true;
+    }
+    
+    bool interpolate(double x, double y, QPointF &out) const
+    {
+        if (approxNodes.empty() || x < approxExtent.left() || x > approxExtent.right()
+            || y < approxExtent.top() || y > approxExtent.bottom()) {
+            return false;
+        }
+        
+        const ApproxNode *node = &approxNodes.front();
+        while (node->firstChild >= 0) {
+            QPointF c = node->rect.center();
+            int child = (x >= c.x() ? 1 : 0) + (y >= c.y() ? 2 : 0);
+            node = &approxNodes[node->firstChild + child];
+        }
+        
+        if (node->exact) {
+            return false;
+        }
+        
+        out = bilinear(*node, x, y);
+        return true;
     }
 };
 
@@ -146,6 +756,12 @@ HGISCoordinateTransform::HGISCoordinateTransform(const HGISCoordinateTransform &
     d->sourceCrs = other.d->sourceCrs;
     d->destCrs = other.d->destCrs;
     initialize();
+    
+    // 근사 격자는 PROJ 객체와 무관하므로 그대로 복사
+    d->approxNodes = other.d->approxNodes;
+    d->approxExtent = other.d->approxExtent;
+    d->approxTolerance = other.d->approxTolerance;
+    d->approximate = d->valid && other.d->approximate;
 }
 
 HGISCoordinateTransform& HGISCoordinateTransform::operator=(const HGISCoordinateTransform &other)
@@ -154,6 +770,11 @@ HGISCoordinateTransform& HGISCoordinateTransform::operator=(const HGISCoordinate
         d->sourceCrs = other.d->sourceCrs;
         d->destCrs = other.d->destCrs;
         initialize();
+        
+        d->approxNodes = other.d->approxNodes;
+        d->approxExtent = other.d->approxExtent;
+        d->approxTolerance = other.d->approxTolerance;
+        d->approximate = d->valid && other.d->approximate;
     }
     return *this;
 }
@@ -205,53 +826,109 @@ QPointF HGISCoordinateTransform::transform(double x, double y) const
 
 QPolygonF HGISCoordinateTransform::transform(const QPolygonF &polygon) const
 {
-    QPolygonF result;
-    result.reserve(polygon.size());
+    QPolygonF result(polygon);
     
-    for (const QPointF &point : polygon) {
-        result.append(transform(point));
+    if (!result.isEmpty()) {
+        // QPointF 배열은 x, y가 교대로 저장되므로 stride 2로 일괄 변환
+        if (!transformCoordinates(&result.data()->rx(), &result.data()->ry(), result.size(), 2)) {
+            // 변환 실패한 점은 단일 점 변환과 동일하게 원래 좌표 유지
+            for (int i = 0; i < result.size(); ++i) {
+                if (result[i].x() == HUGE_VAL || result[i].y() == HUGE_VAL) {
+                    qWarning() << "좌표 변환 실패:" << polygon[i];
+                    result[i] = polygon[i];
+                }
+            }
+        }
     }
     
     return result;
 }
 
-QRectF HGISCoordinateTransform::transformBoundingBox(const QRectF &rect) const
+bool HGISCoordinateTransform::transformCoordinates(double *x, double *y, std::size_t count,
+                                                   std::size_t stride, bool reverse) const
+{
+    if (!d->valid || count == 0 || isShortCircuitable() || !d->pj) {
+        return true;
+    }
+    
+    // 근사 모드: 점마다 격자 보간, 격자 밖은 정밀 변환
+    if (d->approximate && !reverse) {
+        bool ok = true;
+        for (std::size_t k = 0; k < count * stride; k += stride) {
+            QPointF result;
+            if (d->interpolate(x[k], y[k], result)) {
+                x[k] = result.x();
+                y[k] = result.y();
+            } else if (d->nativeTm) {
+                ok = d->transformNative(&x[k], &y[k], 1, 1, false) && ok;
+            } else if (d->transformExact(x[k], y[k], result)) {
+                x[k] = result.x();
+                y[k] = result.y();
+            } else {
+                x[k] = y[k] = HUGE_VAL;
+                ok = false;
+            }
+        }
+        return ok;
+    }
+    
+    if (d->nativeTm) {
+        return d->transformNative(x, y, count, stride, reverse);
+    }
+    
+    const std::size_t strideBytes = stride * sizeof(double);
+    proj_trans_generic(d->pj, reverse ? PJ_INV : PJ_FWD,
+                       x, strideBytes, count,
+                       y, strideBytes, count,
+                       nullptr, 0, 0,
+                       nullptr, 0, 0);
+    
+    for (std::size_t k = 0; k < count * stride; k += stride) {
+        if (x[k] == HUGE_VAL || y[k] == HUGE_VAL) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool HGISCoordinateTransform::usesNativeTransverseMercator() const
+{
+    return d->nativeTm;
+}
+
+QRectF HGISCoordinateTransform::transformBoundingBox(const QRectF &rect, bool reverse,
+                                                    int densifyPoints) const
 {
-    if (!d->valid || rect.isNull()) {
+    if (!d->valid || rect.isNull() || isShortCircuitable() || !d->pj) {
         return rect;
     }
     
-    // 사각형의 4개 모서리와 중간점들을 변환
-    QVector<QPointF> points;
-    points.reserve(9);
-    
-    // 모서리
-    points.append(transform(rect.topLeft()));
-    points.append(transform(rect.topRight()));
-    points.append(transform(rect.bottomLeft()));
-    points.append(transform(rect.bottomRight()));
-    
-    // 중간점 (곡선 투영을 위해)
-    points.append(transform(QPointF(rect.center().x(), rect.top())));
-    points.append(transform(QPointF(rect.center().x(), rect.bottom())));
-    points.append(transform(QPointF(rect.left(), rect.center().y())));
-    points.append(transform(QPointF(rect.right(), rect.center().y())));
-    points.append(transform(rect.center()));
-    
-    // 변환된 점들의 최소/최대값 계산
-    double minX = points[0].x();
-    double maxX = points[0].x();
-    double minY = points[0].y();
-    double maxY = points[0].y();
-    
-    for (const QPointF &p : points) {
-        minX = qMin(minX, p.x());
-        maxX = qMax(maxX, p.x());
-        minY = qMin(minY, p.y());
-        maxY = qMax(maxY, p.y());
+    densifyPoints = qMax(0, densifyPoints);
+    
+    BoundsCacheKey key{crsCacheKey(d->sourceCrs), crsCacheKey(d->destCrs), reverse, densifyPoints,
+                       rect.x(), rect.y(), rect.width(), rect.height()};
+    {
+        QMutexLocker locker(&boundsCacheMutex());
+        if (const QRectF *cached = boundsCache().object(key)) {
+            return *cached;
+        }
+    }
+    
+    QRectF result = d->transformBounds(rect, reverse, densifyPoints);
+    if (result.isNull()) {
+        qWarning() << "범위 변환 실패:" << rect;
+        return result;
     }
     
-    return QRectF(QPointF(minX, minY), QPointF(maxX, maxY));
+    QMutexLocker locker(&boundsCacheMutex());
+    boundsCache().insert(key, new QRectF(result));
+    return result;
+}
+
+void HGISCoordinateTransform::clearBoundingBoxCache()
+{
+    QMutexLocker locker(&boundsCacheMutex());
+    boundsCache().clear();
 }
 
 QPointF HGISCoordinateTransform::transformReverse(const QPointF &point) const
@@ -264,6 +941,38 @@ QPointF HGISCoordinateTransform::transformReverse(double x, double y) const
     return d->transformPoint(x, y, true);
 }
 
+bool HGISCoordinateTransform::setApproximationExtent(const QRectF &sourceExtent, double tolerance)
+{
+    // 동일 범위/허용 오차로 이미 준비된 경우 재사용
+    if (d->approximate && d->approxExtent == sourceExtent.normalized()
+        && qFuzzyCompare(d->approxTolerance, tolerance)) {
+        return true;
+    }
+    
+    // 화면 범위가 바뀔 때마다 (매 프레임) 호출되므로 로그를 남기지 않음
+    return d->buildApproximation(sourceExtent, tolerance);
+}
+
+void HGISCoordinateTransform::clearApproximation()
+{
+    d->clearApproximation();
+}
+
+bool HGISCoordinateTransform::isApproximate() const
+{
+    return d->approximate;
+}
+
+QRectF HGISCoordinateTransform::approximationExtent() const
+{
+    return d->approxExtent;
+}
+
+double HGISCoordinateTransform::approximationTolerance() const
+{
+    return d->approxTolerance;
+}
+
 void HGISCoordinateTransform::initialize()
 {
     d->initialize();
@@ -272,7 +981,9 @@ void HGISCoordinateTransform::initialize()
         qDebug() << "좌표 변환 초기화 성공:"
                  << "EPSG:" << d->sourceCrs.epsgCode() 
                  << "->" 
-                 << "EPSG:" << d->destCrs.epsgCode();
+                 << "EPSG:" << d->destCrs.epsgCode()
+                 << (d->nativeTm ? QString("(네이티브 TM 커널: %1)").arg(HGISTransverseMercator::kernelName())
+                                 : QString());
     }
 }
 
@@ -5,6 +5,7 @@
 #include <QPointF>
 #include <QRectF>
 #include <QPolygonF>
+#include <cstddef>
 #include <memory>
 
 class CORE_EXPORT HGISCoordinateTransform
@@ -39,12 +40,34 @@ public:
     
     // 좌표 변환 - 여러 포인트
     QPolygonF transform(const QPolygonF &polygon) const;
-    QRectF transformBoundingBox(const QRectF &rect) const;
+    
+    // 범위 변환 - 각 변을 densifyPoints개 점으로 조밀화해 변환한 외접 사각형
+    // 결과는 좌표계 쌍과 사각형 기준으로 전역 LRU 캐시에 보관
+    QRectF transformBoundingBox(const QRectF &rect, bool reverse = false,
+                                int densifyPoints = 21) const;
+    static void clearBoundingBoxCache();
+    
+    // 좌표 변환 - 배열 (제자리 변환, stride는 double 단위 간격)
+    // 실패한 좌표는 HUGE_VAL로 채워지고 false 반환
+    bool transformCoordinates(double *x, double *y, std::size_t count,
+                              std::size_t stride = 1, bool reverse = false) const;
+    
+    // 네이티브 TM 커널 사용 여부 (PROJ 파이프라인이 tmerc 단계로만 구성된 경우)
+    bool usesNativeTransverseMercator() const;
     
     // 역변환
     QPointF transformReverse(const QPointF &point) const;
     QPointF transformReverse(double x, double y) const;
     
+    // 근사 변환 모드 (렌더링용)
+    // sourceExtent 위에 적응형 격자를 만들고, 격자 안의 좌표는 쌍선형 보간으로 변환
+    // tolerance는 대상 좌표계 단위의 허용 오차 (보통 0.5픽셀 / 캔버스 축척)
+    bool setApproximationExtent(const QRectF &sourceExtent, double tolerance);
+    void clearApproximation();
+    bool isApproximate() const;
+    QRectF approximationExtent() const;
+    double approximationTolerance() const;
+    
     // 한국 좌표계 변환 헬퍼 메서드
     static QPointF wgs84ToKorea2000Central(const QPointF &wgs84Point);
     static QPointF korea2000CentralToWgs84(const QPointF &koreaPoint);
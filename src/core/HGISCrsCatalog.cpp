@@ -0,0 +1,402 @@
+#include "HGISCrsCatalog.h"
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QThread>
+#include <proj.h>
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+// 목록 앞쪽에 고정 표시하는 주요 좌표계 (PROJ 데이터베이스를 읽지 못할 때의 기본 목록)
+struct FeaturedCrs {
+    int epsg;
+    const char *name;
+    const char *description;
+    bool geographic;
+};
+
+const FeaturedCrs kFeaturedCrs[] = {
+    // 전세계 좌표계
+    {4326, "WGS 84", "World Geodetic System 1984", true},
+    {3857, "WGS 84 / Pseudo-Mercator", "Web Mercator projection", false},
+    
+    // 한국 좌표계 - Korea 2000 TM (현재 표준)
+    {5186, "Korea 2000 / Central Belt", "Korea 2000 / Central Belt 중부원점 TM", false},
+    {5185, "Korea 2000 / West Belt", "Korea 2000 / West Belt 서부원점 TM", false},
+    {5187, "Korea 2000 / East Belt", "Korea 2000 / East Belt 동부원점 TM", false},
+    {5188, "Korea 2000 / East Sea Belt", "Korea 2000 / East Sea Belt 동해(울릉)원점 TM", false},
+    {5179, "Korea 2000 / Unified CS (UTM-K)", "Korea 2000 통일원점 (네이버 지도)", false},
+    
+    // 한국 좌표계 - Korean 1985 (Bessel)
+    {5174, "Korean 1985 / Central Belt", "Korean 1985 중부원점 (Bessel)", false},
+    {5175, "Korean 1985 / West Belt", "Korean 1985 서부원점 (Bessel)", false},
+    {5176, "Korean 1985 / East Belt", "Korean 1985 동부원점 (Bessel)", false},
+    {5177, "Korean 1985 / East Sea Belt", "Korean 1985 동해원점 (Bessel)", false},
+    {5178, "Korean 1985 / Unified CS", "Korean 1985 통일원점 (Bessel)", false},
+    
+    // 한국 좌표계 - 지리좌표계
+    {4737, "Korea 2000", "Korea 2000 지리좌표계 (GRS80)", true},
+    {4162, "Korean 1985", "Korean 1985 지리좌표계 (Bessel)", true},
+    
+    // UTM 좌표계 (한국 지역)
+    {32651, "WGS 84 / UTM zone 51N", "한국 서부 지역 UTM", false},
+    {32652, "WGS 84 / UTM zone 52N", "한국 동부 지역 UTM", false},
+};
+
+// 검색용 정규화: 대소문자 무시, 연속 공백은 하나로
+QString normalized(const QString &text)
+{
+    return text.toCaseFolded().simplified();
+}
+
+// n-gram 키: 한 글자는 그대로, 두 글자는 상위 16비트에 첫 글자
+inline quint32 unigramKey(QChar c)
+{
+    return c.unicode();
+}
+
+inline quint32 bigramKey(QChar a, QChar b)
+{
+    return (static_cast<quint32>(a.unicode()) << 16) | b.unicode();
+}
+
+// 오름차순 인덱스 목록의 교집합
+QVector<int> intersectSorted(const QVector<int> &a, const QVector<int> &b)
+{
+    QVector<int> result;
+    result.reserve(qMin(a.size(), b.size()));
+    std::set_intersection(a.cbegin(), a.cend(), b.cbegin(), b.cend(), std::back_inserter(result));
+    return result;
+}
+
+QVector<int> uniteSorted(const QVector<int> &a, const QVector<int> &b)
+{
+    QVector<int> result;
+    result.reserve(a.size() + b.size());
+    std::set_union(a.cbegin(), a.cend(), b.cbegin(), b.cend(), std::back_inserter(result));
+    return result;
+}
+
+bool isDigits(const QString &text)
+{
+    return !text.isEmpty()
+           && std::all_of(text.cbegin(), text.cend(), [](QChar c) { return c.isDigit(); });
+}
+}
+
+// 로드가 끝나면 통째로 교체되는 불변 목록 + 색인
+struct HGISCrsCatalogData {
+    QVector<HGISCrsCatalog::Entry> entries;
+    QVector<QString> searchText;                 // 정규화된 "이름 설명 지역"
+    QHash<int, int> epsgIndex;                   // EPSG 코드 -> 인덱스
+    std::vector<std::pair<QString, int>> codes;  // 코드 문자열 정렬 (접두어 검색)
+    QHash<quint32, QVector<int>> grams;          // n-gram -> 오름차순 인덱스 목록
+    
+    void append(const HGISCrsCatalog::Entry &entry)
+    {
+        if (epsgIndex.contains(entry.epsg)) {
+            return;
+        }
+        epsgIndex.insert(entry.epsg, entries.size());
+        entries.append(entry);
+    }
+    
+    void buildIndex()
+    {
+        searchText.clear();
+        searchText.reserve(entries.size());
+        codes.clear();
+        codes.reserve(entries.size());
+        grams.clear();
+        
+        for (int i = 0; i < entries.size(); ++i) {
+            const HGISCrsCatalog::Entry &entry = entries[i];
+            const QString text = normalized(entry.name + ' ' + entry.description + ' ' + entry.areaName);
+            searchText.append(text);
+            codes.emplace_back(QString::number(entry.epsg), i);
+            
+            // 같은 항목이 같은 n-gram 목록에 두 번 들어가지 않도록 마지막 값만 확인
+            for (int k = 0; k < text.size(); ++k) {
+                QVector<int> &uni = grams[unigramKey(text[k])];
+                if (uni.isEmpty() || uni.last() != i) {
+                    uni.append(i);
+                }
+                if (k + 1 < text.size()) {
+                    QVector<int> &bi = grams[bigramKey(text[k], text[k + 1])];
+                    if (bi.isEmpty() || bi.last() != i) {
+                        bi.append(i);
+                    }
+                }
+            }
+        }
+        
+        std::sort(codes.begin(), codes.end());
+    }
+    
+    // 단어를 포함하는 항목 (n-gram 후보 교집합 후 실제 포함 여부 확인)
+    QVector<int> matchText(const QString &word) const
+    {
+        if (word.size() == 1) {
+            return grams.value(unigramKey(word[0]));
+        }
+        
+        QVector<const QVector<int>*> lists;
+        for (int k = 0; k + 1 < word.size(); ++k) {
+            auto it = grams.constFind(bigramKey(word[k], word[k + 1]));
+            if (it == grams.constEnd()) {
+                return QVector<int>();
+            }
+            lists.append(&it.value());
+        }
+        
+        // 짧은 목록부터 교집합
+        std::sort(lists.begin(), lists.end(),
+                  [](const QVector<int> *a, const QVector<int> *b) { return a->size() < b->size(); });
+        QVector<int> candidates = *lists.first();
+        for (int k = 1; k < lists.size() && !candidates.isEmpty(); ++k) {
+            candidates = intersectSorted(candidates, *lists[k]);
+        }
+        
+        // 세 글자 이상은 bigram 교집합만으로 순서가 보장되지 않으므로 확인
+        if (word.size() > 2) {
+            QVector<int> verified;
+            verified.reserve(candidates.size());
+            for (int index : candidates) {
+                if (searchText[index].contains(word)) {
+                    verified.append(index);
+                }
+            }
+            return verified;
+        }
+        return candidates;
+    }
+    
+    QVector<int> matchCodePrefix(const QString &prefix) const
+    {
+        auto first = std::lower_bound(codes.cbegin(), codes.cend(), std::make_pair(prefix, -1));
+        QVector<int> result;
+        for (auto it = first; it != codes.cend() && it->first.startsWith(prefix); ++it) {
+            result.append(it->second);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+};
+
+class HGISCrsCatalog::Private
+{
+public:
+    std::shared_ptr<const HGISCrsCatalogData> data;
+    bool loaded = false;
+    bool loading = false;
+    
+    static std::shared_ptr<HGISCrsCatalogData> featuredCatalog()
+    {
+        auto data = std::make_shared<HGISCrsCatalogData>();
+        for (const FeaturedCrs &crs : kFeaturedCrs) {
+            HGISCrsCatalog::Entry entry;
+            entry.epsg = crs.epsg;
+            entry.name = QString::fromUtf8(crs.name);
+            entry.description = QString::fromUtf8(crs.description);
+            entry.geographic = crs.geographic;
+            data->append(entry);
+        }
+        return data;
+    }
+    
+    // PROJ 데이터베이스에서 EPSG 2차원 지리/투영 좌표계 전체 읽기 (작업 스레드에서 호출)
+    static std::shared_ptr<const HGISCrsCatalogData> loadFromDatabase()
+    {
+        QElapsedTimer timer;
+        timer.start();
+        
+        std::shared_ptr<HGISCrsCatalogData> data = featuredCatalog();
+        const int featuredCount = data->entries.size();
+        
+        // PROJ 컨텍스트는 스레드 간에 공유할 수 없으므로 별도로 생성
+        PJ_CONTEXT *ctx = proj_context_create();
+        int count = 0;
+        PROJ_CRS_INFO **list = proj_get_crs_info_list_from_database(ctx, "EPSG", nullptr, &count);
+        
+        if (list) {
+            QVector<HGISCrsCatalog::Entry> others;
+            others.reserve(count);
+            
+            for (int i = 0; i < count; ++i) {
+                const PROJ_CRS_INFO *info = list[i];
+                if (info->type != PJ_TYPE_GEOGRAPHIC_2D_CRS && info->type != PJ_TYPE_PROJECTED_CRS) {
+                    continue;
+                }
+                
+                bool ok = false;
+                int epsg = QString::fromLatin1(info->code).toInt(&ok);
+                if (!ok) {
+                    continue;
+                }
+                
+                // 주요 좌표계는 한국어 설명을 유지하고 사용 지역만 보충
+                auto featured = data->epsgIndex.constFind(epsg);
+                if (featured != data->epsgIndex.constEnd()) {
+                    data->entries[featured.value()].areaName = QString::fromUtf8(info->area_name);
+                    continue;
+                }
+                
+                HGISCrsCatalog::Entry entry;
+                entry.epsg = epsg;
+                entry.name = QString::fromUtf8(info->name);
+                entry.areaName = QString::fromUtf8(info->area_name);
+                entry.description = entry.areaName;
+                entry.geographic = (info->type == PJ_TYPE_GEOGRAPHIC_2D_CRS);
+                entry.deprecated = info->deprecated != 0;
+                others.append(entry);
+            }
+            
+            std::sort(others.begin(), others.end(),
+                      [](const HGISCrsCatalog::Entry &a, const HGISCrsCatalog::Entry &b) {
+                          return a.epsg < b.epsg;
+                      });
+            for (const HGISCrsCatalog::Entry &entry : others) {
+                data->append(entry);
+            }
+            
+            proj_crs_info_list_destroy(list);
+        } else {
+            qWarning() << "PROJ 데이터베이스에서 좌표계 목록을 읽을 수 없습니다. 기본 목록 사용";
+        }
+        
+        proj_context_destroy(ctx);
+        
+        data->buildIndex();
+        
+        qInfo() << "좌표계 목록 로드 완료:" << data->entries.size() << "개"
+                << "(주요" << featuredCount << "개)"
+                << timer.elapsed() << "ms";
+        
+        return data;
+    }
+};
+
+HGISCrsCatalog* HGISCrsCatalog::instance()
+{
+    static HGISCrsCatalog *catalog = new HGISCrsCatalog();
+    return catalog;
+}
+
+HGISCrsCatalog::HGISCrsCatalog(QObject *parent)
+    : QObject(parent)
+    , d(std::make_unique<Private>())
+{
+    // 로드 전에도 주요 좌표계는 바로 검색 가능
+    std::shared_ptr<HGISCrsCatalogData> featured = Private::featuredCatalog();
+    featured->buildIndex();
+    d->data = featured;
+}
+
+HGISCrsCatalog::~HGISCrsCatalog() = default;
+
+void HGISCrsCatalog::loadInBackground()
+{
+    if (d->loaded || d->loading) {
+        return;
+    }
+    d->loading = true;
+    
+    QThread *thread = QThread::create([this]() {
+        std::shared_ptr<const HGISCrsCatalogData> data = Private::loadFromDatabase();
+        
+        // 색인 교체는 카탈로그가 속한 스레드에서 수행
+        QMetaObject::invokeMethod(this, [this, data]() {
+            d->data = data;
+            d->loaded = true;
+            d->loading = false;
+            emit loaded();
+        }, Qt::QueuedConnection);
+    });
+    connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+    thread->start(QThread::LowPriority);
+}
+
+bool HGISCrsCatalog::isLoaded() const
+{
+    return d->loaded;
+}
+
+int HGISCrsCatalog::count() const
+{
+    return d->data->entries.size();
+}
+
+const HGISCrsCatalog::Entry &HGISCrsCatalog::entry(int index) const
+{
+    return d->data->entries.at(index);
+}
+
+int HGISCrsCatalog::indexOfEpsg(int epsg) const
+{
+    return d->data->epsgIndex.value(epsg, -1);
+}
+
+QVector<int> HGISCrsCatalog::search(const QString &text) const
+{
+    const HGISCrsCatalogData &data = *d->data;
+    const QStringList words = normalized(text).split(' ', QString::SkipEmptyParts);
+    
+    if (words.isEmpty()) {
+        QVector<int> all(data.entries.size());
+        std::iota(all.begin(), all.end(), 0);
+        return all;
+    }
+    
+    QVector<int> result;
+    QVector<int> codeMatches;
+    bool first = true;
+    
+    for (QString word : words) {
+        // "epsg:5186" 형식 허용
+        if (word.startsWith("epsg:")) {
+            word = word.mid(5);
+            if (word.isEmpty()) {
+                continue;
+            }
+        }
+        
+        QVector<int> matches = data.matchText(word);
+        if (isDigits(word)) {
+            QVector<int> prefix = data.matchCodePrefix(word);
+            codeMatches = uniteSorted(codeMatches, prefix);
+            matches = uniteSorted(matches, prefix);
+        }
+        
+        result = first ? matches : intersectSorted(result, matches);
+        first = false;
+        if (result.isEmpty()) {
+            break;
+        }
+    }
+    
+    if (first) {
+        // "epsg:"만 입력한 경우
+        return search(QString());
+    }
+    
+    // EPSG 코드 접두어가 일치하는 항목을 앞으로 (짧은 코드 = 정확히 일치에 가까움)
+    if (!codeMatches.isEmpty()) {
+        std::stable_sort(result.begin(), result.end(), [&](int a, int b) {
+            const bool codeA = std::binary_search(codeMatches.cbegin(), codeMatches.cend(), a);
+            const bool codeB = std::binary_search(codeMatches.cbegin(), codeMatches.cend(), b);
+            if (codeA != codeB) {
+                return codeA;
+            }
+            if (codeA) {
+                return data.entries[a].epsg < data.entries[b].epsg;
+            }
+            return false;
+        });
+    }
+    
+    return result;
+}
@@ -0,0 +1,58 @@
+#ifndef HGISCRSCATALOG_H
+#define HGISCRSCATALOG_H
+
+#include <QObject>
+#include <QString>
+#include <QVector>
+#include <memory>
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+// PROJ 데이터베이스의 EPSG 좌표계 목록과 검색 색인
+// 목록은 한 번만 백그라운드 스레드에서 읽고, 검색은 EPSG 코드 접두어와
+// 이름/설명(한국어 포함)의 문자 n-gram 역색인으로 처리
+class CORE_EXPORT HGISCrsCatalog : public QObject
+{
+    Q_OBJECT
+    
+public:
+    struct Entry {
+        int epsg = 0;
+        QString name;
+        QString description;    // 한국어 설명 (한국 좌표계) 또는 사용 지역
+        QString areaName;
+        bool geographic = false;
+        bool deprecated = false;
+    };
+    
+    static HGISCrsCatalog* instance();
+    ~HGISCrsCatalog();
+    
+    // 백그라운드 로드 시작 (이미 로드했거나 로드 중이면 무시)
+    void loadInBackground();
+    bool isLoaded() const;
+    
+    // 목록 접근
+    int count() const;
+    const Entry &entry(int index) const;
+    int indexOfEpsg(int epsg) const;
+    
+    // 검색 - 공백으로 구분된 모든 단어를 포함하는 항목의 인덱스 (카탈로그 순서)
+    // 숫자 단어는 EPSG 코드 접두어로도 검색하며, 코드가 일치하는 항목이 먼저 옴
+    QVector<int> search(const QString &text) const;
+    
+signals:
+    void loaded();
+    
+private:
+    explicit HGISCrsCatalog(QObject *parent = nullptr);
+    
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+#endif // HGISCRSCATALOG_H
@@ -0,0 +1,251 @@
+#include "HGISDictionaryColumn.h"
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QSet>
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+// 고유값 비율과 상관없이 허용하는 사전 크기 (작은 표)
+constexpr std::size_t kMinDictionarySize = 64;
+
+// 전체를 부호화하기 전에 볼 표본 행 수 (행 전체에 고르게)
+constexpr std::size_t kSampleRows = 4096;
+
+std::size_t distinctLimit(std::size_t rows, double maxDistinctRatio, int maxDictionarySize)
+{
+    const std::size_t byRatio = static_cast<std::size_t>(static_cast<double>(rows) * maxDistinctRatio);
+    return std::min(std::max(kMinDictionarySize, byRatio), static_cast<std::size_t>(qMax(1, maxDictionarySize)));
+}
+}
+
+class HGISDictionaryColumn::Private
+{
+public:
+    QString fieldName;
+    bool valid = false;
+    long rowCount = 0;
+    
+    QStringList dictionary;                 // 코드 -> 값
+    QHash<QString, quint32> lookup;         // 값 -> 코드
+    std::vector<quint16> narrowCodes;       // 사전이 작을 때 (NULL은 0xFFFF)
+    std::vector<quint32> wideCodes;
+    
+    static constexpr quint16 kNarrowNull = 0xFFFFu;
+    
+    quint32 code(long row) const
+    {
+        if (row < 0 || row >= rowCount) {
+            return NullCode;
+        }
+        if (!wideCodes.empty()) {
+            return wideCodes[static_cast<std::size_t>(row)];
+        }
+        const quint16 narrow = narrowCodes[static_cast<std::size_t>(row)];
+        return narrow == kNarrowNull ? NullCode : narrow;
+    }
+};
+
+HGISDictionaryColumn::HGISDictionaryColumn()
+    : d(std::make_shared<Private>())
+{
+}
+
+HGISDictionaryColumn::~HGISDictionaryColumn() = default;
+
+bool HGISDictionaryColumn::encode(std::vector<HGISGdalProvider::Feature> &features, const QString &fieldName,
+                                  double maxDistinctRatio, int maxDictionarySize)
+{
+    QElapsedTimer timer;
+    timer.start();
+    
+    auto data = std::make_shared<Private>();
+    data->fieldName = fieldName;
+    data->rowCount = static_cast<long>(features.size());
+    
+    // 표본에서 이미 고유값이 많으면 (자유 텍스트) 전체 사전을 만들지 않고 거부
+    if (features.size() > kSampleRows) {
+        const std::size_t stride = features.size() / kSampleRows;
+        const std::size_t sampleLimit = distinctLimit(kSampleRows, maxDistinctRatio, maxDictionarySize);
+        QSet<QString> sampleValues;
+        for (std::size_t row = 0; row < features.size(); row += stride) {
+            const QVariant value = features[row].attributes.value(fieldName);
+            if (value.isNull()) {
+                continue;
+            }
+            if (value.type() != QVariant::String) {
+                d = std::make_shared<Private>();
+                return false;
+            }
+            sampleValues.insert(value.toString());
+            if (static_cast<std::size_t>(sampleValues.size()) > sampleLimit) {
+                d = std::make_shared<Private>();
+                return false;
+            }
+        }
+    }
+    
+    const std::size_t maxDistinct = distinctLimit(features.size(), maxDistinctRatio, maxDictionarySize);
+    std::vector<quint32> codes;
+    codes.reserve(features.size());
+    
+    for (HGISGdalProvider::Feature &feature : features) {
+        auto it = feature.attributes.find(fieldName);
+        if (it == feature.attributes.end() || it.value().isNull()) {
+            codes.push_back(NullCode);
+            continue;
+        }
+        if (it.value().type() != QVariant::String) {
+            d = std::make_shared<Private>();
+            return false;
+        }
+        
+        const QString text = it.value().toString();
+        auto found = data->lookup.constFind(text);
+        if (found != data->lookup.constEnd()) {
+            // 사전의 문자열로 바꿔 이 피처의 사본은 해제
+            it.value() = QVariant(data->dictionary[static_cast<int>(found.value())]);
+            codes.push_back(found.value());
+            continue;
+        }
+        
+        if (static_cast<std::size_t>(data->dictionary.size()) >= maxDistinct) {
+            // 자유 텍스트 필드 - 부호화해도 이득이 없음
+            d = std::make_shared<Private>();
+            return false;
+        }
+        const quint32 code = static_cast<quint32>(data->dictionary.size());
+        data->dictionary.append(text);
+        data->lookup.insert(text, code);
+        codes.push_back(code);
+    }
+    
+    // 사전이 작으면 16비트 코드로 줄임 (0xFFFF는 NULL)
+    if (data->dictionary.size() < Private::kNarrowNull) {
+        data->narrowCodes.reserve(codes.size());
+        for (quint32 code : codes) {
+            data->narrowCodes.push_back(code == NullCode ? Private::kNarrowNull : static_cast<quint16>(code));
+        }
+    } else {
+        data->wideCodes = std::move(codes);
+    }
+    
+    data->valid = true;
+    d = data;
+    
+    qDebug() << "사전 부호화:" << fieldName << "행 수:" << d->rowCount
+             << "고유값:" << d->dictionary.size() << (isWide() ? "32비트" : "16비트")
+             << timer.elapsed() << "ms";
+    return true;
+}
+
+bool HGISDictionaryColumn::isValid() const
+{
+    return d->valid;
+}
+
+QString HGISDictionaryColumn::fieldName() const
+{
+    return d->fieldName;
+}
+
+long HGISDictionaryColumn::rowCount() const
+{
+    return d->rowCount;
+}
+
+int HGISDictionaryColumn::dictionarySize() const
+{
+    return d->dictionary.size();
+}
+
+bool HGISDictionaryColumn::isWide() const
+{
+    return !d->wideCodes.empty();
+}
+
+qint64 HGISDictionaryColumn::memoryUsage() const
+{
+    qint64 bytes = static_cast<qint64>(d->narrowCodes.capacity() * sizeof(quint16)
+                                       + d->wideCodes.capacity() * sizeof(quint32));
+    for (const QString &value : d->dictionary) {
+        bytes += 24 + 48 + value.capacity() * 2;    // 문자열 + 해시 노드 (문자열은 사전과 공유)
+    }
+    return bytes;
+}
+
+quint32 HGISDictionaryColumn::code(long row) const
+{
+    return d->code(row);
+}
+
+quint32 HGISDictionaryColumn::codeOf(const QString &value) const
+{
+    return d->lookup.value(value, NullCode);
+}
+
+QString HGISDictionaryColumn::value(long row) const
+{
+    return dictionaryValue(d->code(row));
+}
+
+QString HGISDictionaryColumn::dictionaryValue(quint32 code) const
+{
+    if (code == NullCode || code >= static_cast<quint32>(d->dictionary.size())) {
+        return QString();
+    }
+    return d->dictionary[static_cast<int>(code)];
+}
+
+QStringList HGISDictionaryColumn::dictionary() const
+{
+    return d->dictionary;
+}
+
+QVector<quint32> HGISDictionaryColumn::codes() const
+{
+    QVector<quint32> result;
+    result.reserve(static_cast<int>(d->rowCount));
+    for (long row = 0; row < d->rowCount; ++row) {
+        result.append(d->code(row));
+    }
+    return result;
+}
+
+QVector<long> HGISDictionaryColumn::findRows(quint32 code) const
+{
+    QVector<long> rows;
+    if (code == NullCode) {
+        return rows;
+    }
+    
+    if (!d->wideCodes.empty()) {
+        for (std::size_t row = 0; row < d->wideCodes.size(); ++row) {
+            if (d->wideCodes[row] == code) {
+                rows.append(static_cast<long>(row));
+            }
+        }
+    } else if (code < Private::kNarrowNull) {
+        const quint16 narrow = static_cast<quint16>(code);
+        for (std::size_t row = 0; row < d->narrowCodes.size(); ++row) {
+            if (d->narrowCodes[row] == narrow) {
+                rows.append(static_cast<long>(row));
+            }
+        }
+    }
+    return rows;
+}
+
+QVector<long> HGISDictionaryColumn::codeCounts() const
+{
+    QVector<long> counts(d->dictionary.size(), 0);
+    for (long row = 0; row < d->rowCount; ++row) {
+        const quint32 code = d->code(row);
+        if (code != NullCode) {
+            ++counts[static_cast<int>(code)];
+        }
+    }
+    return counts;
+}
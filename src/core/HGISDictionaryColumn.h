@@ -0,0 +1,63 @@
+#ifndef HGISDICTIONARYCOLUMN_H
+#define HGISDICTIONARYCOLUMN_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <memory>
+#include <vector>
+#include "providers/HGISGdalProvider.h"
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+// 사전 부호화한 문자열 열 (시대, 유적 종류, 보존 상태처럼 값 종류가 적은 필드)
+// 고유값은 사전에 한 번만 두고 피처(행)마다 코드만 보관 - 사전이 65535개 미만이면 16비트, 아니면 32비트
+// 같은 값 비교는 정수 비교, 행 순서는 부호화한 피처 목록의 순서
+// 복사하면 코드와 사전을 공유 (부호화한 뒤에는 바뀌지 않음)
+class CORE_EXPORT HGISDictionaryColumn
+{
+public:
+    static constexpr quint32 NullCode = 0xFFFFFFFFu;    // 값이 없거나 NULL
+    
+    HGISDictionaryColumn();
+    ~HGISDictionaryColumn();
+    
+    // 피처 목록의 문자열 필드를 부호화하면서 같은 값의 QString을 사전의 것으로 바꿔 공유 (중복 문자열 해제)
+    // 고유값이 maxDictionarySize 또는 행 수 x maxDistinctRatio (최소 64) 를 넘거나
+    // 문자열이 아닌 값이 있으면 실패 (자유 텍스트 필드) - 표본 행을 먼저 보고 고유값이 많으면 바로 거부
+    bool encode(std::vector<HGISGdalProvider::Feature> &features, const QString &fieldName,
+                double maxDistinctRatio = 0.05, int maxDictionarySize = 65535);
+    
+    bool isValid() const;
+    QString fieldName() const;
+    long rowCount() const;
+    int dictionarySize() const;
+    bool isWide() const;            // 32비트 코드 사용 여부
+    qint64 memoryUsage() const;     // 코드와 사전의 메모리 사용량 추정 (바이트)
+    
+    // 코드 <-> 값
+    quint32 code(long row) const;
+    quint32 codeOf(const QString &value) const;     // 사전에 없으면 NullCode
+    QString value(long row) const;
+    QString dictionaryValue(quint32 code) const;
+    QStringList dictionary() const;
+    
+    // 전체 코드 (행 순서, 파이썬 검증 도구 등에 넘길 때)
+    QVector<quint32> codes() const;
+    
+    // 코드가 같은 행 (오름차순)
+    QVector<long> findRows(quint32 code) const;
+    
+    // 코드별 행 수 (사전 순서)
+    QVector<long> codeCounts() const;
+    
+private:
+    class Private;
+    std::shared_ptr<Private> d;
+};
+
+#endif // HGISDICTIONARYCOLUMN_H
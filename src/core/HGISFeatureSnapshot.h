@@ -0,0 +1,99 @@
+#ifndef HGISFEATURESNAPSHOT_H
+#define HGISFEATURESNAPSHOT_H
+
+#include "HGISGeometryStore.h"
+#include "providers/HGISGdalProvider.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// 레이어가 읽어 둔 피처 목록의 불변 스냅샷 (참조 카운트 공유)
+// 복사해도 피처를 복제하지 않으므로 분석 도구, 다른 스레드에 그대로 넘길 수 있음
+// 레이어는 공유 중인 목록을 고치지 않고 새 목록으로 바꾸므로 (쓰기 시 복사),
+// 다시 읽기나 캐시 해제 뒤에도 스냅샷은 받은 시점의 피처를 그대로 가리킴
+// 좌표는 피처의 geometry가 아니라 좌표 저장소에 있으면 geometry(i)로 읽음
+class HGISFeatureSnapshot
+{
+public:
+    using Feature = HGISGdalProvider::Feature;
+    using FeatureList = std::vector<Feature>;
+    using const_iterator = FeatureList::const_iterator;
+    
+    HGISFeatureSnapshot() = default;
+    
+    explicit HGISFeatureSnapshot(std::shared_ptr<const FeatureList> features,
+                                 std::shared_ptr<const HGISGeometryStore> geometryStore = nullptr)
+        : m_features(std::move(features))
+        , m_geometryStore(std::move(geometryStore))
+        , m_generation(m_features ? nextGeneration() : 0)
+    {
+    }
+    
+    // 읽은 피처 목록을 넘겨받아 스냅샷 생성 (복사하지 않고 이동)
+    static HGISFeatureSnapshot fromFeatures(FeatureList &&features,
+                                            std::shared_ptr<const HGISGeometryStore> geometryStore = nullptr)
+    {
+        return HGISFeatureSnapshot(std::make_shared<const FeatureList>(std::move(features)),
+                                   std::move(geometryStore));
+    }
+    
+    bool isNull() const { return !m_features; }
+    bool isEmpty() const { return size() == 0; }
+    bool empty() const { return isEmpty(); }
+    std::size_t size() const { return m_features ? m_features->size() : 0; }
+    
+    const Feature &operator[](std::size_t index) const { return (*m_features)[index]; }
+    const Feature &at(std::size_t index) const { return features().at(index); }
+    
+    const_iterator begin() const { return features().begin(); }
+    const_iterator end() const { return features().end(); }
+    
+    // 통계/정렬 엔진처럼 const std::vector& 를 받는 곳에 그대로 전달
+    const FeatureList &features() const
+    {
+        static const FeatureList none;
+        return m_features ? *m_features : none;
+    }
+    
+    // 피처 index의 좌표 (좌표 저장소가 있으면 복원)
+    std::vector<QPointF> geometry(std::size_t index) const
+    {
+        return m_geometryStore ? m_geometryStore->geometry(index) : (*m_features)[index].geometry;
+    }
+    
+    const HGISGeometryStore *geometryStore() const { return m_geometryStore.get(); }
+    
+    // 같은 피처 목록에 좌표 저장소만 바꾼 스냅샷 (좌표 압축/해제)
+    HGISFeatureSnapshot withGeometryStore(std::shared_ptr<const HGISGeometryStore> geometryStore) const
+    {
+        HGISFeatureSnapshot snapshot(*this);
+        snapshot.m_geometryStore = std::move(geometryStore);
+        return snapshot;
+    }
+    
+    // 같은 목록을 공유하는지, 공유 중인 스냅샷 수
+    bool isSharedWith(const HGISFeatureSnapshot &other) const { return m_features == other.m_features; }
+    long useCount() const { return m_features.use_count(); }
+    
+    // 피처 목록 세대 번호 (새 목록마다 증가, 좌표 저장소만 바꾼 스냅샷은 그대로)
+    // 스냅샷을 붙잡지 않고 같은 목록인지 비교할 때 사용, 빈 스냅샷은 0
+    std::uint64_t generation() const { return m_generation; }
+    
+    // 고쳐 쓸 사본이 필요할 때만 명시적으로 복사
+    FeatureList toVector() const { return features(); }
+    
+private:
+    std::shared_ptr<const FeatureList> m_features;
+    std::shared_ptr<const HGISGeometryStore> m_geometryStore;
+    std::uint64_t m_generation = 0;
+    
+    static std::uint64_t nextGeneration()
+    {
+        static std::atomic<std::uint64_t> counter{0};
+        return ++counter;
+    }
+};
+
+#endif // HGISFEATURESNAPSHOT_H
@@ -0,0 +1,283 @@
+#include "HGISFieldSketch.h"
+#include <QtAlgorithms>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+// splitmix64 마무리 함수 (비트를 고르게 섞음)
+quint64 mix64(quint64 x)
+{
+    x ^= x >> 30;
+    x *= Q_UINT64_C(0xbf58476d1ce4e5b9);
+    x ^= x >> 27;
+    x *= Q_UINT64_C(0x94d049bb133111eb);
+    x ^= x >> 31;
+    return x;
+}
+}
+
+quint64 hgisValueHash(const QVariant &value)
+{
+    if (value.isNull()) {
+        return mix64(0);
+    }
+    
+    switch (value.type()) {
+        case QVariant::Int:
+        case QVariant::UInt:
+        case QVariant::LongLong:
+        case QVariant::ULongLong:
+        case QVariant::Double: {
+            double number = value.toDouble();
+            if (number == 0.0) {
+                number = 0.0;   // -0 과 +0 을 같게
+            }
+            quint64 bits;
+            std::memcpy(&bits, &number, sizeof(bits));
+            return mix64(bits ^ Q_UINT64_C(0x9e3779b97f4a7c15));
+        }
+        default: {
+            // FNV-1a (UTF-16 코드 단위)
+            const QString text = value.toString();
+            quint64 hash = Q_UINT64_C(0xcbf29ce484222325);
+            for (const QChar ch : text) {
+                hash ^= ch.unicode();
+                hash *= Q_UINT64_C(0x100000001b3);
+            }
+            return mix64(hash);
+        }
+    }
+}
+
+HGISHyperLogLog::HGISHyperLogLog(int precision)
+    : m_precision(qBound(4, precision, 18))
+    , m_registers(std::size_t(1) << m_precision, 0)
+{
+}
+
+void HGISHyperLogLog::add(const QVariant &value)
+{
+    addHash(hgisValueHash(value));
+}
+
+void HGISHyperLogLog::addHash(quint64 hash)
+{
+    // 상위 p비트는 레지스터 번호, 나머지 비트의 선행 0 개수 + 1 이 순위
+    const std::size_t index = static_cast<std::size_t>(hash >> (64 - m_precision));
+    const quint64 rest = hash << m_precision;
+    const int maxRank = 64 - m_precision + 1;
+    const int rank = rest == 0 ? maxRank : qMin(maxRank, int(qCountLeadingZeroBits(rest)) + 1);
+    
+    if (m_registers[index] < rank) {
+        m_registers[index] = static_cast<quint8>(rank);
+    }
+    m_empty = false;
+}
+
+bool HGISHyperLogLog::merge(const HGISHyperLogLog &other)
+{
+    if (other.m_precision != m_precision) {
+        return false;
+    }
+    
+    for (std::size_t i = 0; i < m_registers.size(); ++i) {
+        m_registers[i] = std::max(m_registers[i], other.m_registers[i]);
+    }
+    m_empty = m_empty && other.m_empty;
+    return true;
+}
+
+double HGISHyperLogLog::estimate() const
+{
+    if (m_empty) {
+        return 0.0;
+    }
+    
+    const double m = static_cast<double>(m_registers.size());
+    double sum = 0.0;
+    int zeros = 0;
+    for (quint8 rank : m_registers) {
+        sum += std::ldexp(1.0, -rank);
+        if (rank == 0) {
+            ++zeros;
+        }
+    }
+    
+    const double alpha = 0.7213 / (1.0 + 1.079 / m);
+    const double estimate = alpha * m * m / sum;
+    
+    // 작은 범위는 선형 계수로 보정 (64비트 해시라 큰 범위 보정은 불필요)
+    if (estimate <= 2.5 * m && zeros > 0) {
+        return m * std::log(m / zeros);
+    }
+    return estimate;
+}
+
+HGISSpaceSaving::HGISSpaceSaving(int capacity)
+    : m_capacity(qMax(1, capacity))
+{
+    m_heap.reserve(m_capacity);
+}
+
+void HGISSpaceSaving::add(const QVariant &value, long count)
+{
+    if (count <= 0) {
+        return;
+    }
+    
+    m_total += count;
+    const QString key = value.toString();
+    
+    auto it = m_positions.constFind(key);
+    if (it != m_positions.constEnd()) {
+        const int index = it.value();
+        m_heap[index].count += count;
+        siftDown(index);
+        return;
+    }
+    
+    if (size() < m_capacity) {
+        Counter counter;
+        counter.key = key;
+        counter.value = value;
+        counter.count = count;
+        m_heap.push_back(counter);
+        m_positions.insert(key, size() - 1);
+        siftUp(size() - 1);
+        return;
+    }
+    
+    // 가장 작은 카운터를 새 값으로 교체 (이전 빈도는 오차로 남김)
+    Counter &root = m_heap[0];
+    m_positions.remove(root.key);
+    root.error = root.count;
+    root.count += count;
+    root.key = key;
+    root.value = value;
+    m_positions.insert(key, 0);
+    siftDown(0);
+}
+
+void HGISSpaceSaving::merge(const HGISSpaceSaving &other)
+{
+    const long minimumThis = minimumCount();
+    const long minimumOther = other.minimumCount();
+    
+    std::vector<Counter> merged;
+    merged.reserve(m_heap.size() + other.m_heap.size());
+    
+    for (const Counter &counter : m_heap) {
+        Counter result = counter;
+        auto it = other.m_positions.constFind(counter.key);
+        if (it != other.m_positions.constEnd()) {
+            result.count += other.m_heap[it.value()].count;
+            result.error += other.m_heap[it.value()].error;
+        } else {
+            result.count += minimumOther;
+            result.error += minimumOther;
+        }
+        merged.push_back(result);
+    }
+    
+    for (const Counter &counter : other.m_heap) {
+        if (!m_positions.contains(counter.key)) {
+            Counter result = counter;
+            result.count += minimumThis;
+            result.error += minimumThis;
+            merged.push_back(result);
+        }
+    }
+    
+    m_total += other.m_total;
+    rebuild(std::move(merged));
+}
+
+QVector<HGISValueCount> HGISSpaceSaving::top(int n) const
+{
+    std::vector<const Counter *> sorted;
+    sorted.reserve(m_heap.size());
+    for (const Counter &counter : m_heap) {
+        sorted.push_back(&counter);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const Counter *a, const Counter *b) {
+        return a->count != b->count ? a->count > b->count : a->key < b->key;
+    });
+    
+    const int limit = n > 0 ? qMin(n, size()) : size();
+    QVector<HGISValueCount> result;
+    result.reserve(limit);
+    for (int i = 0; i < limit; ++i) {
+        HGISValueCount entry;
+        entry.value = sorted[i]->value;
+        entry.count = sorted[i]->count;
+        entry.error = sorted[i]->error;
+        result.append(entry);
+    }
+    return result;
+}
+
+long HGISSpaceSaving::minimumCount() const
+{
+    // 카운터가 남아 있으면 빠진 값은 한 번도 나오지 않은 것
+    return size() < m_capacity ? 0 : m_heap.front().count;
+}
+
+void HGISSpaceSaving::siftUp(int index)
+{
+    while (index > 0) {
+        const int parent = (index - 1) / 2;
+        if (m_heap[parent].count <= m_heap[index].count) {
+            break;
+        }
+        swapCounters(parent, index);
+        index = parent;
+    }
+}
+
+void HGISSpaceSaving::siftDown(int index)
+{
+    const int count = size();
+    while (true) {
+        const int left = 2 * index + 1;
+        const int right = left + 1;
+        int smallest = index;
+        if (left < count && m_heap[left].count < m_heap[smallest].count) {
+            smallest = left;
+        }
+        if (right < count && m_heap[right].count < m_heap[smallest].count) {
+            smallest = right;
+        }
+        if (smallest == index) {
+            break;
+        }
+        swapCounters(smallest, index);
+        index = smallest;
+    }
+}
+
+void HGISSpaceSaving::swapCounters(int a, int b)
+{
+    std::swap(m_heap[a], m_heap[b]);
+    m_positions[m_heap[a].key] = a;
+    m_positions[m_heap[b].key] = b;
+}
+
+void HGISSpaceSaving::rebuild(std::vector<Counter> counters)
+{
+    // 빈도 내림차순으로 capacity개만 남기고, 오름차순 배열(= 유효한 최소 힙)로 저장
+    std::sort(counters.begin(), counters.end(), [](const Counter &a, const Counter &b) {
+        return a.count != b.count ? a.count > b.count : a.key < b.key;
+    });
+    if (static_cast<int>(counters.size()) > m_capacity) {
+        counters.resize(m_capacity);
+    }
+    std::reverse(counters.begin(), counters.end());
+    
+    m_heap = std::move(counters);
+    m_positions.clear();
+    for (int i = 0; i < size(); ++i) {
+        m_positions.insert(m_heap[i].key, i);
+    }
+}
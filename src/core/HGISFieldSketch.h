@@ -0,0 +1,90 @@
+#ifndef HGISFIELDSKETCH_H
+#define HGISFIELDSKETCH_H
+
+#include <QHash>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+#include <vector>
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+// 필드 값의 64비트 해시 (숫자는 타입과 무관하게 같은 값이면 같은 해시)
+CORE_EXPORT quint64 hgisValueHash(const QVariant &value);
+
+// HyperLogLog 고유값 개수 추정
+// 정밀도 p에서 2^p 바이트 레지스터를 쓰며 상대 오차는 약 1.04 / sqrt(2^p)
+// (기본 p = 14: 16KB, 약 0.8%)
+// 같은 정밀도의 스케치끼리는 병합할 수 있어 스레드별/레이어별로 따로 만든 뒤 합칠 수 있음
+class CORE_EXPORT HGISHyperLogLog
+{
+public:
+    explicit HGISHyperLogLog(int precision = 14);
+    
+    void add(const QVariant &value);
+    void addHash(quint64 hash);
+    
+    // 정밀도가 다르면 false
+    bool merge(const HGISHyperLogLog &other);
+    
+    double estimate() const;
+    int precision() const { return m_precision; }
+    bool isEmpty() const { return m_empty; }
+    
+private:
+    int m_precision;
+    std::vector<quint8> m_registers;
+    bool m_empty = true;
+};
+
+// 빈도 상위 값 하나
+struct HGISValueCount
+{
+    QVariant value;
+    long count = 0;     // 추정 빈도 (실제 빈도 이상)
+    long error = 0;     // 과대 추정 상한 (count - error 가 실제 빈도의 하한)
+};
+
+// Space-Saving 빈도 상위 k 요약 (Metwally et al.)
+// capacity개 카운터만 유지하며, 실제 빈도가 전체의 1/capacity를 넘는 값은 반드시 포함됨
+// 병합은 Agarwal et al.의 병합 가능 요약 방식 (없는 쪽의 최솟값을 오차로 더함)
+class CORE_EXPORT HGISSpaceSaving
+{
+public:
+    explicit HGISSpaceSaving(int capacity = 64);
+    
+    void add(const QVariant &value, long count = 1);
+    void merge(const HGISSpaceSaving &other);
+    
+    // 빈도 내림차순 상위 n개 (n <= 0이면 전체)
+    QVector<HGISValueCount> top(int n = 0) const;
+    
+    int capacity() const { return m_capacity; }
+    int size() const { return static_cast<int>(m_heap.size()); }
+    long total() const { return m_total; }
+    
+private:
+    struct Counter {
+        QString key;
+        QVariant value;
+        long count = 0;
+        long error = 0;
+    };
+    
+    long minimumCount() const;
+    void siftUp(int index);
+    void siftDown(int index);
+    void swapCounters(int a, int b);
+    void rebuild(std::vector<Counter> counters);
+    
+    int m_capacity;
+    long m_total = 0;
+    std::vector<Counter> m_heap;    // count 기준 최소 힙
+    QHash<QString, int> m_positions; // 키 -> 힙 위치
+};
+
+#endif // HGISFIELDSKETCH_H
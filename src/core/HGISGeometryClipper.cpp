@@ -0,0 +1,218 @@
+#include "HGISGeometryClipper.h"
+#include <algorithm>
+
+namespace
+{
+enum class ClipEdge
+{
+    Left,
+    Right,
+    Top,
+    Bottom
+};
+
+inline bool isInside(const QPointF &point, ClipEdge edge, const QRectF &clip)
+{
+    switch (edge) {
+        case ClipEdge::Left:
+            return point.x() >= clip.left();
+        case ClipEdge::Right:
+            return point.x() <= clip.right();
+        case ClipEdge::Top:
+            return point.y() >= clip.top();
+        case ClipEdge::Bottom:
+            return point.y() <= clip.bottom();
+    }
+    return true;
+}
+
+// 안쪽 점과 바깥쪽 점을 잇는 선분이 변과 만나는 점 (두 점의 해당 좌표는 항상 다름)
+inline QPointF intersection(const QPointF &a, const QPointF &b, ClipEdge edge, const QRectF &clip)
+{
+    if (edge == ClipEdge::Left || edge == ClipEdge::Right) {
+        const double x = edge == ClipEdge::Left ? clip.left() : clip.right();
+        const double t = (x - a.x()) / (b.x() - a.x());
+        return QPointF(x, a.y() + t * (b.y() - a.y()));
+    }
+    const double y = edge == ClipEdge::Top ? clip.top() : clip.bottom();
+    const double t = (y - a.y()) / (b.y() - a.y());
+    return QPointF(a.x() + t * (b.x() - a.x()), y);
+}
+
+// 변 하나에 대한 Sutherland-Hodgman 단계
+void clipAgainstEdge(const QVector<QPointF> &input, QVector<QPointF> &output, ClipEdge edge, const QRectF &clip)
+{
+    output.clear();
+    if (input.isEmpty()) {
+        return;
+    }
+    
+    QPointF previous = input.last();
+    bool previousInside = isInside(previous, edge, clip);
+    for (const QPointF &current : input) {
+        const bool currentInside = isInside(current, edge, clip);
+        if (currentInside != previousInside) {
+            output.append(intersection(previous, current, edge, clip));
+        }
+        if (currentInside) {
+            output.append(current);
+        }
+        previous = current;
+        previousInside = currentInside;
+    }
+}
+
+// 범위 box가 clip과 겹치는지 (크기 0인 범위도 비교)
+inline bool overlaps(const QRectF &box, const QRectF &clip)
+{
+    return box.right() >= clip.left() && box.left() <= clip.right()
+           && box.bottom() >= clip.top() && box.top() <= clip.bottom();
+}
+
+inline bool within(const QRectF &box, const QRectF &clip)
+{
+    return box.left() >= clip.left() && box.right() <= clip.right()
+           && box.top() >= clip.top() && box.bottom() <= clip.bottom();
+}
+
+// 선분 a-b 중 범위 안쪽 구간의 매개변수 [t0, t1] (겹치지 않으면 false)
+bool liangBarsky(const QPointF &a, const QPointF &b, const QRectF &clip, double &t0, double &t1)
+{
+    const double dx = b.x() - a.x();
+    const double dy = b.y() - a.y();
+    const double p[4] = {-dx, dx, -dy, dy};
+    const double q[4] = {a.x() - clip.left(), clip.right() - a.x(), a.y() - clip.top(), clip.bottom() - a.y()};
+    
+    t0 = 0.0;
+    t1 = 1.0;
+    for (int i = 0; i < 4; ++i) {
+        if (p[i] == 0.0) {
+            // 변과 평행 - 바깥쪽이면 겹치지 않음
+            if (q[i] < 0.0) {
+                return false;
+            }
+            continue;
+        }
+        
+        const double t = q[i] / p[i];
+        if (p[i] < 0.0) {
+            if (t > t1) {
+                return false;
+            }
+            t0 = std::max(t0, t);
+        } else {
+            if (t < t0) {
+                return false;
+            }
+            t1 = std::min(t1, t);
+        }
+    }
+    return true;
+}
+}
+
+void HGISGeometryClipper::clipPolygon(const std::vector<QPointF> &points, const QRectF &clip, QVector<QPointF> &result)
+{
+    result.clear();
+    if (points.size() < 3) {
+        return;
+    }
+    const QRectF box = bounds(points);
+    if (!overlaps(box, clip)) {
+        return;
+    }
+    
+    result.reserve(static_cast<int>(points.size()));
+    for (const QPointF &point : points) {
+        result.append(point);
+    }
+    if (within(box, clip)) {
+        return;
+    }
+    
+    // 범위 밖으로 나간 변만 자름
+    QVector<QPointF> buffer;
+    buffer.reserve(result.size());
+    const ClipEdge edges[4] = {ClipEdge::Left, ClipEdge::Right, ClipEdge::Top, ClipEdge::Bottom};
+    const bool outside[4] = {box.left() < clip.left(), box.right() > clip.right(),
+                             box.top() < clip.top(), box.bottom() > clip.bottom()};
+    for (int i = 0; i < 4; ++i) {
+        if (outside[i]) {
+            clipAgainstEdge(result, buffer, edges[i], clip);
+            result.swap(buffer);
+        }
+    }
+    
+    if (result.size() < 3) {
+        result.clear();
+    }
+}
+
+void HGISGeometryClipper::clipPolyline(const std::vector<QPointF> &points, const QRectF &clip,
+                                       QVector<QVector<QPointF>> &parts)
+{
+    parts.clear();
+    if (points.size() < 2) {
+        return;
+    }
+    
+    const QRectF box = bounds(points);
+    if (!overlaps(box, clip)) {
+        return;
+    }
+    if (within(box, clip)) {
+        parts.append(QVector<QPointF>(points.begin(), points.end()));
+        return;
+    }
+    
+    QVector<QPointF> part;
+    auto flush = [&]() {
+        if (part.size() >= 2) {
+            parts.append(part);
+        }
+        part.clear();
+    };
+    
+    for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+        const QPointF &a = points[i];
+        const QPointF &b = points[i + 1];
+        double t0 = 0.0;
+        double t1 = 1.0;
+        if (!liangBarsky(a, b, clip, t0, t1)) {
+            flush();
+            continue;
+        }
+        
+        // 범위 밖에서 들어오면 새 조각 시작
+        if (t0 > 0.0) {
+            flush();
+        }
+        if (part.isEmpty()) {
+            part.append(t0 > 0.0 ? a + (b - a) * t0 : a);
+        }
+        part.append(t1 < 1.0 ? a + (b - a) * t1 : b);
+        
+        // 범위 밖으로 나가면 조각 끝
+        if (t1 < 1.0) {
+            flush();
+        }
+    }
+    flush();
+}
+
+QRectF HGISGeometryClipper::bounds(const std::vector<QPointF> &points)
+{
+    if (points.empty()) {
+        return QRectF();
+    }
+    
+    double minX = points.front().x(), maxX = minX;
+    double minY = points.front().y(), maxY = minY;
+    for (const QPointF &point : points) {
+        minX = std::min(minX, point.x());
+        minY = std::min(minY, point.y());
+        maxX = std::max(maxX, point.x());
+        maxY = std::max(maxY, point.y());
+    }
+    return QRectF(QPointF(minX, minY), QPointF(maxX, maxY));
+}
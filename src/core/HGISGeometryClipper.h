@@ -0,0 +1,34 @@
+#ifndef HGISGEOMETRYCLIPPER_H
+#define HGISGEOMETRYCLIPPER_H
+
+#include <QPointF>
+#include <QRectF>
+#include <QVector>
+#include <vector>
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+// 그리기 전에 다각형과 선을 화면 범위로 자름
+// 크게 확대했을 때 화면 밖으로 수 km 뻗은 좌표를 QPainter에 넘기지 않도록 (래스터화 비용, 정밀도 문제)
+// 잘린 경계가 보이지 않도록 clip은 선 굵기만큼 넓힌 화면 범위를 넘겨야 함
+// 범위 안에 다 들어오는 도형은 복사만 하고, 범위와 겹치지 않으면 비움
+class CORE_EXPORT HGISGeometryClipper
+{
+public:
+    // 다각형 (외곽 링) - Sutherland-Hodgman, 네 변에 대해 차례로 자름
+    // 자른 결과가 범위 가장자리를 따라가는 변을 포함할 수 있으나 채우기 결과는 같음
+    static void clipPolygon(const std::vector<QPointF> &points, const QRectF &clip, QVector<QPointF> &result);
+    
+    // 선 - 선분마다 Liang-Barsky, 범위를 벗어났다 다시 들어오면 조각을 나눔 (2점 미만 조각은 버림)
+    static void clipPolyline(const std::vector<QPointF> &points, const QRectF &clip,
+                             QVector<QVector<QPointF>> &parts);
+    
+    // 좌표들의 범위 (비었으면 빈 QRectF)
+    static QRectF bounds(const std::vector<QPointF> &points);
+};
+
+#endif // HGISGEOMETRYCLIPPER_H
@@ -0,0 +1,410 @@
+#include "HGISGeometryStore.h"
+#include <QDebug>
+#include <QElapsedTimer>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// 복원 루프는 AVX2 버전과 기본 버전을 함께 컴파일하고 런타임에 선택 (HGISTransverseMercator와 같은 방식)
+#if defined(__has_attribute)
+  #if __has_attribute(target_clones) && (defined(__x86_64__) || defined(__i386__)) && defined(__linux__)
+    #define HGIS_GEOMETRY_MULTIVERSION __attribute__((target_clones("arch=haswell", "default")))
+  #endif
+#endif
+#ifndef HGIS_GEOMETRY_MULTIVERSION
+  #define HGIS_GEOMETRY_MULTIVERSION
+#endif
+
+namespace
+{
+// int32 (x, y) 쌍을 double (x, y) 쌍으로 복원
+HGIS_GEOMETRY_MULTIVERSION
+void dequantize(const qint32 *in, double *out, std::size_t pointCount,
+                double originX, double originY, double scale)
+{
+#pragma omp simd
+    for (std::size_t i = 0; i < pointCount; ++i) {
+        out[2 * i] = originX + static_cast<double>(in[2 * i]) * scale;
+        out[2 * i + 1] = originY + static_cast<double>(in[2 * i + 1]) * scale;
+    }
+}
+
+// 범위 여러 개를 한 번에 검사 (겹치면 1) - 네 배열을 따로 두어 연속으로 읽음
+HGIS_GEOMETRY_MULTIVERSION
+void testBoxes(const double *minX, const double *minY, const double *maxX, const double *maxY,
+               std::size_t count, double left, double top, double right, double bottom, quint8 *hits)
+{
+#pragma omp simd
+    for (std::size_t i = 0; i < count; ++i) {
+        hits[i] = static_cast<quint8>((maxX[i] >= left) & (minX[i] <= right)
+                                      & (maxY[i] >= top) & (minY[i] <= bottom));
+    }
+}
+
+// QPointF가 double 쌍이면 복원 결과를 바로 씀
+constexpr bool kPointIsDoublePair = sizeof(qreal) == sizeof(double) && sizeof(QPointF) == 2 * sizeof(double);
+
+// 절댓값이 작은 차분이 작은 부호 없는 값이 되도록 변환 (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...)
+inline quint64 zigZag(qint64 value)
+{
+    return (static_cast<quint64>(value) << 1) ^ static_cast<quint64>(value >> 63);
+}
+
+inline qint64 unZigZag(quint64 value)
+{
+    return static_cast<qint64>(value >> 1) ^ -static_cast<qint64>(value & 1);
+}
+
+// 7비트씩, 상위 비트는 다음 바이트가 있음을 표시
+inline void writeVarint(std::vector<quint8> &out, quint64 value)
+{
+    while (value >= 0x80) {
+        out.push_back(static_cast<quint8>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<quint8>(value));
+}
+
+inline quint64 readVarint(const quint8 *&in)
+{
+    quint64 value = 0;
+    int shift = 0;
+    while (*in & 0x80) {
+        value |= static_cast<quint64>(*in++ & 0x7F) << shift;
+        shift += 7;
+    }
+    value |= static_cast<quint64>(*in++) << shift;
+    return value;
+}
+
+// 범위 누적
+struct Extent
+{
+    double minX = std::numeric_limits<double>::max();
+    double minY = std::numeric_limits<double>::max();
+    double maxX = -std::numeric_limits<double>::max();
+    double maxY = -std::numeric_limits<double>::max();
+    
+    void include(const QPointF *points, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            minX = std::min(minX, points[i].x());
+            minY = std::min(minY, points[i].y());
+            maxX = std::max(maxX, points[i].x());
+            maxY = std::max(maxY, points[i].y());
+        }
+    }
+};
+}
+
+class HGISGeometryStore::Private
+{
+public:
+    Encoding encoding = Encoding::Double;
+    double resolution = 0.0;
+    double originX = 0.0;
+    double originY = 0.0;
+    
+    std::vector<std::size_t> offsets{0};    // 피처별 첫 좌표 위치 (피처 수 + 1)
+    std::vector<double> coordinates;        // 원래 정밀도 (x, y, x, y, ...)
+    std::vector<qint32> quantized;          // 양자화 (x, y, x, y, ...)
+    std::vector<quint8> packed;             // 압축 (피처마다 처음 점은 원점 기준, 이후는 이전 점과의 차분)
+    std::vector<std::size_t> byteOffsets{0};    // 압축 시 피처별 첫 바이트 위치
+    
+    // 피처별 범위 (저장 방식과 관계없이 원래 좌표 기준, 좌표가 없으면 최소 > 최대)
+    std::vector<double> boxMinX;
+    std::vector<double> boxMinY;
+    std::vector<double> boxMaxX;
+    std::vector<double> boxMaxY;
+    
+    std::size_t pointCount(std::size_t index) const
+    {
+        return index + 1 < offsets.size() ? offsets[index + 1] - offsets[index] : 0;
+    }
+    
+    // 저장 방식과 원점 결정 - 격자 좌표가 int32 (압축은 double로 정확히 나타낼 수 있는 정수)에 들어가야 함
+    void configure(Encoding requested, double requestedResolution, const Extent &extent,
+                   std::size_t featureCount, std::size_t total)
+    {
+        if (requested != Encoding::Double && total > 0) {
+            const double range = std::max(extent.maxX - extent.minX, extent.maxY - extent.minY);
+            const double limit = requested == Encoding::Quantized
+                ? static_cast<double>(std::numeric_limits<qint32>::max()) - 1.0
+                : 9007199254740992.0;   // 2^53
+            if (requestedResolution > 0.0 && range / requestedResolution < limit) {
+                encoding = requested;
+                resolution = requestedResolution;
+                originX = std::floor(extent.minX / resolution) * resolution;
+                originY = std::floor(extent.minY / resolution) * resolution;
+            } else {
+                qWarning() << "좌표 범위가 해상도에 비해 커서 원래 정밀도로 저장:" << requestedResolution;
+            }
+        }
+        
+        offsets.reserve(featureCount + 1);
+        boxMinX.reserve(featureCount);
+        boxMinY.reserve(featureCount);
+        boxMaxX.reserve(featureCount);
+        boxMaxY.reserve(featureCount);
+        switch (encoding) {
+        case Encoding::Quantized:
+            quantized.reserve(total * 2);
+            break;
+        case Encoding::Compressed:
+            byteOffsets.reserve(featureCount + 1);
+            packed.reserve(total * 2);      // 좌표당 최소 1바이트, 끝나면 남는 용량 반환
+            break;
+        case Encoding::Double:
+            coordinates.reserve(total * 2);
+            break;
+        }
+    }
+    
+    // 피처 하나의 좌표를 저장 방식에 맞게 덧붙임
+    void append(const QPointF *points, std::size_t count)
+    {
+        Extent box;
+        box.include(points, count);
+        boxMinX.push_back(box.minX);
+        boxMinY.push_back(box.minY);
+        boxMaxX.push_back(box.maxX);
+        boxMaxY.push_back(box.maxY);
+        
+        const double inverse = resolution > 0.0 ? 1.0 / resolution : 0.0;
+        switch (encoding) {
+        case Encoding::Quantized:
+            for (std::size_t i = 0; i < count; ++i) {
+                quantized.push_back(static_cast<qint32>(std::llround((points[i].x() - originX) * inverse)));
+                quantized.push_back(static_cast<qint32>(std::llround((points[i].y() - originY) * inverse)));
+            }
+            break;
+        case Encoding::Compressed: {
+            qint64 previousX = 0;
+            qint64 previousY = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                const qint64 x = std::llround((points[i].x() - originX) * inverse);
+                const qint64 y = std::llround((points[i].y() - originY) * inverse);
+                writeVarint(packed, zigZag(x - previousX));
+                writeVarint(packed, zigZag(y - previousY));
+                previousX = x;
+                previousY = y;
+            }
+            byteOffsets.push_back(packed.size());
+            break;
+        }
+        case Encoding::Double:
+            for (std::size_t i = 0; i < count; ++i) {
+                coordinates.push_back(points[i].x());
+                coordinates.push_back(points[i].y());
+            }
+            break;
+        }
+        offsets.push_back(offsets.back() + count);
+    }
+    
+    void finish()
+    {
+        if (encoding == Encoding::Compressed) {
+            packed.shrink_to_fit();
+        }
+    }
+};
+
+HGISGeometryStore::HGISGeometryStore()
+    : d(std::make_unique<Private>())
+{
+}
+
+HGISGeometryStore::~HGISGeometryStore() = default;
+
+void HGISGeometryStore::build(std::vector<HGISGdalProvider::Feature> &features, Encoding encoding, double resolution)
+{
+    QElapsedTimer timer;
+    timer.start();
+    
+    Extent extent;
+    std::size_t total = 0;
+    for (const HGISGdalProvider::Feature &feature : features) {
+        total += feature.geometry.size();
+        extent.include(feature.geometry.data(), feature.geometry.size());
+    }
+    
+    d = std::make_unique<Private>();
+    d->configure(encoding, resolution, extent, features.size(), total);
+    for (HGISGdalProvider::Feature &feature : features) {
+        d->append(feature.geometry.data(), feature.geometry.size());
+        std::vector<QPointF>().swap(feature.geometry);
+    }
+    d->finish();
+    
+    qDebug() << "좌표 저장소:" << features.size() << "피처" << total << "점"
+             << encodingName() << memoryUsage() / 1024 << "KB" << timer.elapsed() << "ms";
+}
+
+void HGISGeometryStore::build(const HGISGeometryStore &source, Encoding encoding, double resolution)
+{
+    if (&source == this) {
+        return;
+    }
+    
+    QElapsedTimer timer;
+    timer.start();
+    
+    // 범위를 구하고 다시 저장하는 동안 피처 하나 크기의 버퍼만 사용
+    Extent extent;
+    std::vector<QPointF> points;
+    for (std::size_t i = 0; i < source.featureCount(); ++i) {
+        points.clear();
+        source.decode(i, points);
+        extent.include(points.data(), points.size());
+    }
+    
+    auto rebuilt = std::make_unique<Private>();
+    rebuilt->configure(encoding, resolution, extent, source.featureCount(), source.totalPointCount());
+    for (std::size_t i = 0; i < source.featureCount(); ++i) {
+        points.clear();
+        source.decode(i, points);
+        rebuilt->append(points.data(), points.size());
+    }
+    rebuilt->finish();
+    d = std::move(rebuilt);
+    
+    qDebug() << "좌표 저장소 변환:" << source.encodingName() << source.memoryUsage() / 1024 << "KB ->"
+             << encodingName() << memoryUsage() / 1024 << "KB" << timer.elapsed() << "ms";
+}
+
+HGISGeometryStore::Encoding HGISGeometryStore::encoding() const
+{
+    return d->encoding;
+}
+
+double HGISGeometryStore::resolution() const
+{
+    return d->resolution;
+}
+
+QPointF HGISGeometryStore::origin() const
+{
+    return QPointF(d->originX, d->originY);
+}
+
+double HGISGeometryStore::maximumError() const
+{
+    return d->encoding != Encoding::Double ? d->resolution * 0.5 : 0.0;
+}
+
+QString HGISGeometryStore::encodingName() const
+{
+    switch (d->encoding) {
+    case Encoding::Quantized:
+        return QString("int32 (해상도 %1)").arg(d->resolution);
+    case Encoding::Compressed:
+        return QString("varint (해상도 %1)").arg(d->resolution);
+    case Encoding::Double:
+        break;
+    }
+    return QString("double");
+}
+
+std::size_t HGISGeometryStore::featureCount() const
+{
+    return d->offsets.size() - 1;
+}
+
+std::size_t HGISGeometryStore::pointCount(std::size_t index) const
+{
+    return d->pointCount(index);
+}
+
+std::size_t HGISGeometryStore::totalPointCount() const
+{
+    return d->offsets.back();
+}
+
+void HGISGeometryStore::decode(std::size_t index, std::vector<QPointF> &out) const
+{
+    const std::size_t count = d->pointCount(index);
+    if (count == 0) {
+        return;
+    }
+    
+    const std::size_t first = d->offsets[index];
+    const std::size_t start = out.size();
+    out.resize(start + count);
+    
+    if (d->encoding == Encoding::Quantized) {
+        if (kPointIsDoublePair) {
+            dequantize(&d->quantized[first * 2], reinterpret_cast<double *>(&out[start]), count,
+                       d->originX, d->originY, d->resolution);
+        } else {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[start + i] = QPointF(d->originX + d->quantized[(first + i) * 2] * d->resolution,
+                                         d->originY + d->quantized[(first + i) * 2 + 1] * d->resolution);
+            }
+        }
+    } else if (d->encoding == Encoding::Compressed) {
+        const quint8 *in = d->packed.data() + d->byteOffsets[index];
+        qint64 x = 0;
+        qint64 y = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            x += unZigZag(readVarint(in));
+            y += unZigZag(readVarint(in));
+            out[start + i] = QPointF(d->originX + static_cast<double>(x) * d->resolution,
+                                     d->originY + static_cast<double>(y) * d->resolution);
+        }
+    } else {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[start + i] = QPointF(d->coordinates[(first + i) * 2], d->coordinates[(first + i) * 2 + 1]);
+        }
+    }
+}
+
+std::vector<QPointF> HGISGeometryStore::geometry(std::size_t index) const
+{
+    std::vector<QPointF> points;
+    decode(index, points);
+    return points;
+}
+
+QRectF HGISGeometryStore::bounds(std::size_t index) const
+{
+    if (d->pointCount(index) == 0) {
+        return QRectF();
+    }
+    return QRectF(QPointF(d->boxMinX[index], d->boxMinY[index]), QPointF(d->boxMaxX[index], d->boxMaxY[index]));
+}
+
+std::vector<std::size_t> HGISGeometryStore::intersecting(const QRectF &extent) const
+{
+    std::vector<std::size_t> result;
+    const std::size_t count = featureCount();
+    if (count == 0) {
+        return result;
+    }
+    
+    const QRectF rect = extent.normalized();
+    constexpr std::size_t kChunk = 1024;
+    quint8 hits[kChunk];
+    for (std::size_t first = 0; first < count; first += kChunk) {
+        const std::size_t chunk = std::min(kChunk, count - first);
+        testBoxes(&d->boxMinX[first], &d->boxMinY[first], &d->boxMaxX[first], &d->boxMaxY[first], chunk,
+                  rect.left(), rect.top(), rect.right(), rect.bottom(), hits);
+        for (std::size_t i = 0; i < chunk; ++i) {
+            if (hits[i]) {
+                result.push_back(first + i);
+            }
+        }
+    }
+    return result;
+}
+
+qint64 HGISGeometryStore::memoryUsage() const
+{
+    return static_cast<qint64>(d->offsets.capacity() * sizeof(std::size_t)
+                               + d->coordinates.capacity() * sizeof(double)
+                               + d->quantized.capacity() * sizeof(qint32)
+                               + d->packed.capacity()
+                               + d->byteOffsets.capacity() * sizeof(std::size_t)
+                               + (d->boxMinX.capacity() + d->boxMinY.capacity()
+                                  + d->boxMaxX.capacity() + d->boxMaxY.capacity()) * sizeof(double));
+}
@@ -0,0 +1,80 @@
+#ifndef HGISGEOMETRYSTORE_H
+#define HGISGEOMETRYSTORE_H
+
+#include <QPointF>
+#include <QRectF>
+#include <QString>
+#include <memory>
+#include <vector>
+#include "providers/HGISGdalProvider.h"
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+// 좌표 저장 방식
+enum class HGISCoordinateEncoding
+{
+    Double,         // 원래 정밀도 (x, y double)
+    Quantized,      // 레이어 원점 기준 int32 오프셋 (해상도 단위), 메모리 절반
+    Compressed      // 피처마다 이전 점과의 차이를 zig-zag varint로 (해상도 단위), 보이지 않는 레이어용
+};
+
+// 레이어가 메모리에 읽어 둔 모든 피처의 좌표를 한 배열에 모아 보관
+// 피처 i의 좌표는 [offset(i), offset(i + 1)) 구간 - 피처마다 벡터를 두지 않음
+// 양자화 모드는 (좌표 - 원점) / 해상도 를 int32로 저장하고 읽을 때 벡터화한 루프로 복원
+// 압축 모드는 같은 격자 좌표의 차분을 가변 길이로 저장 (MVT와 같은 방식, 이웃한 점이면 좌표당 1~3바이트)
+// 피처별 범위는 최소/최대 x, y 네 배열로 따로 보관 (화면 범위 검사를 한 번에 여러 피처씩)
+// 한 번 만든 뒤에는 바뀌지 않으므로 여러 스레드에서 동시에 읽어도 됨
+class CORE_EXPORT HGISGeometryStore
+{
+public:
+    using Encoding = HGISCoordinateEncoding;
+    
+    HGISGeometryStore();
+    ~HGISGeometryStore();
+    
+    // 피처 목록의 좌표를 옮겨 담음 (피처의 geometry는 비워짐)
+    // 양자화 범위가 int32를 넘으면 (해상도가 너무 작으면) 원래 정밀도로 저장
+    void build(std::vector<HGISGdalProvider::Feature> &features,
+               Encoding encoding = Encoding::Double, double resolution = 0.001);
+    
+    // 다른 저장소의 좌표를 다른 방식으로 다시 저장 (압축/해제)
+    // 같은 해상도의 양자화 <-> 압축은 손실 없음
+    void build(const HGISGeometryStore &source,
+               Encoding encoding = Encoding::Double, double resolution = 0.001);
+    
+    Encoding encoding() const;
+    double resolution() const;          // 양자화/압축 단위 (레이어 좌표계 단위, 예: 0.001 = 1mm)
+    QPointF origin() const;
+    double maximumError() const;        // 복원 좌표의 최대 오차 (해상도의 절반, 원래 정밀도면 0)
+    QString encodingName() const;       // 로그용 (예: "int32 (해상도 0.001)")
+    
+    std::size_t featureCount() const;
+    std::size_t pointCount(std::size_t index) const;
+    std::size_t totalPointCount() const;
+    
+    // 피처 하나의 좌표를 out 뒤에 이어 붙임
+    void decode(std::size_t index, std::vector<QPointF> &out) const;
+    std::vector<QPointF> geometry(std::size_t index) const;
+    
+    // 피처 하나의 범위 (좌표가 없으면 빈 QRectF, 점 하나면 크기 0)
+    // 만들 때 피처별로 계산해 두므로 좌표를 복원하지 않음
+    QRectF bounds(std::size_t index) const;
+    
+    // 범위가 extent와 겹치는 피처 (오름차순) - 좌표는 건드리지 않고 범위 배열만 벡터화해 검사
+    std::vector<std::size_t> intersecting(const QRectF &extent) const;
+    
+    qint64 memoryUsage() const;
+    
+private:
+    HGISGeometryStore(const HGISGeometryStore &) = delete;
+    HGISGeometryStore &operator=(const HGISGeometryStore &) = delete;
+    
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+#endif // HGISGEOMETRYSTORE_H
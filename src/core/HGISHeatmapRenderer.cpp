@@ -0,0 +1,368 @@
+#include "HGISHeatmapRenderer.h"
+#include <QColor>
+#include <QRect>
+#include <QVector>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// 누적 루프는 AVX2 버전과 기본 버전을 함께 컴파일하고 런타임에 선택 (HGISTransverseMercator와 같은 방식)
+#if defined(__has_attribute)
+  #if __has_attribute(target_clones) && (defined(__x86_64__) || defined(__i386__)) && defined(__linux__)
+    #define HGIS_HEATMAP_MULTIVERSION __attribute__((target_clones("arch=haswell", "default")))
+  #endif
+#endif
+#ifndef HGIS_HEATMAP_MULTIVERSION
+  #define HGIS_HEATMAP_MULTIVERSION
+#endif
+
+namespace
+{
+constexpr std::size_t kProjectChunk = 4096;
+
+// 지도 좌표를 화면 픽셀 좌표로 (아핀 변환)
+HGIS_HEATMAP_MULTIVERSION
+void projectPoints(const double *x, const double *y, std::size_t count,
+                   double m11, double m12, double m21, double m22, double dx, double dy,
+                   float *px, float *py)
+{
+#pragma omp simd
+    for (std::size_t i = 0; i < count; ++i) {
+        px[i] = static_cast<float>(m11 * x[i] + m21 * y[i] + dx);
+        py[i] = static_cast<float>(m12 * x[i] + m22 * y[i] + dy);
+    }
+}
+
+// out += weight * in
+HGIS_HEATMAP_MULTIVERSION
+void addScaled(float *out, const float *in, std::size_t count, float weight)
+{
+#pragma omp simd
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] += weight * in[i];
+    }
+}
+
+HGIS_HEATMAP_MULTIVERSION
+float maximumOf(const float *values, std::size_t count)
+{
+    float result = 0.0f;
+#pragma omp simd reduction(max:result)
+    for (std::size_t i = 0; i < count; ++i) {
+        result = values[i] > result ? values[i] : result;
+    }
+    return result;
+}
+
+// 격자를 (shiftX, shiftY)만큼 옮김, 새로 드러난 칸은 0
+void shiftGrid(std::vector<float> &grid, int width, int height, int shiftX, int shiftY)
+{
+    std::vector<float> shifted(grid.size(), 0.0f);
+    const int left = std::max(0, shiftX);
+    const int right = std::min(width, width + shiftX);
+    if (right > left) {
+        for (int y = std::max(0, shiftY); y < std::min(height, height + shiftY); ++y) {
+            std::memcpy(&shifted[static_cast<std::size_t>(y) * width + left],
+                        &grid[static_cast<std::size_t>(y - shiftY) * width + (left - shiftX)],
+                        static_cast<std::size_t>(right - left) * sizeof(float));
+        }
+    }
+    grid.swap(shifted);
+}
+}
+
+class HGISHeatmapRenderer::Private
+{
+public:
+    double radius = 20.0;
+    QGradientStops colorRamp = HGISHeatmapRenderer::defaultColorRamp();
+    double maximumDensity = 0.0;
+    
+    // 점 (x, y 따로)과 가중치
+    std::vector<double> xs;
+    std::vector<double> ys;
+    std::vector<float> weights;
+    
+    // 가우스 커널 (2R + 1, 중심 1), 색상표 (256, premultiplied)
+    int kernelRadius = 0;
+    std::vector<float> kernel;
+    QVector<QRgb> palette;
+    
+    // 직전 계산 - 누적 격자는 (W + 2R) x (H + 2R), 밀도는 W x H
+    bool valid = false;
+    QTransform transform;
+    QSize size;
+    std::vector<float> binned;
+    std::vector<float> density;
+    
+    int gridWidth() const { return size.width() + 2 * kernelRadius; }
+    int gridHeight() const { return size.height() + 2 * kernelRadius; }
+    
+    // 3 시그마에서 자르는 가우스 커널
+    void updateKernel()
+    {
+        kernelRadius = std::max(1, static_cast<int>(std::ceil(radius)));
+        const double sigma = kernelRadius / 3.0;
+        kernel.resize(static_cast<std::size_t>(2 * kernelRadius + 1));
+        for (int k = -kernelRadius; k <= kernelRadius; ++k) {
+            kernel[static_cast<std::size_t>(k + kernelRadius)] = static_cast<float>(std::exp(-0.5 * (k / sigma) * (k / sigma)));
+        }
+    }
+    
+    // 색상 단계를 256단계 색상표로 (0은 항상 투명)
+    void updatePalette()
+    {
+        palette.resize(256);
+        palette[0] = 0;
+        for (int i = 1; i < 256; ++i) {
+            const double t = i / 255.0;
+            QColor color = colorRamp.isEmpty() ? QColor(Qt::red) : colorRamp.last().second;
+            for (int s = 0; s < colorRamp.size(); ++s) {
+                if (t > colorRamp[s].first) {
+                    continue;
+                }
+                if (s == 0) {
+                    color = colorRamp[0].second;
+                } else {
+                    const QGradientStop &a = colorRamp[s - 1];
+                    const QGradientStop &b = colorRamp[s];
+                    const double f = b.first > a.first ? (t - a.first) / (b.first - a.first) : 1.0;
+                    color = QColor::fromRgbF(a.second.redF() + (b.second.redF() - a.second.redF()) * f,
+                                             a.second.greenF() + (b.second.greenF() - a.second.greenF()) * f,
+                                             a.second.blueF() + (b.second.blueF() - a.second.blueF()) * f,
+                                             a.second.alphaF() + (b.second.alphaF() - a.second.alphaF()) * f);
+                }
+                break;
+            }
+            palette[i] = qPremultiply(color.rgba());
+        }
+    }
+    
+    // 점 가중치를 누적 격자에 더함 (regions가 비어 있지 않으면 그 격자 영역에 떨어지는 점만)
+    void bin(const QTransform &toDevice, const QVector<QRect> &regions)
+    {
+        const int width = gridWidth();
+        const int height = gridHeight();
+        std::vector<float> px(kProjectChunk);
+        std::vector<float> py(kProjectChunk);
+        
+        for (std::size_t first = 0; first < xs.size(); first += kProjectChunk) {
+            const std::size_t count = std::min(kProjectChunk, xs.size() - first);
+            projectPoints(&xs[first], &ys[first], count,
+                          toDevice.m11(), toDevice.m12(), toDevice.m21(), toDevice.m22(),
+                          toDevice.dx(), toDevice.dy(), px.data(), py.data());
+            
+            for (std::size_t i = 0; i < count; ++i) {
+                const int gx = static_cast<int>(std::floor(px[i])) + kernelRadius;
+                const int gy = static_cast<int>(std::floor(py[i])) + kernelRadius;
+                if (gx < 0 || gy < 0 || gx >= width || gy >= height) {
+                    continue;
+                }
+                if (!regions.isEmpty()
+                    && std::none_of(regions.begin(), regions.end(),
+                                    [gx, gy](const QRect &region) { return region.contains(gx, gy); })) {
+                    continue;
+                }
+                binned[static_cast<std::size_t>(gy) * width + gx] += weights[first + i];
+            }
+        }
+    }
+    
+    // 화면 영역 region의 밀도를 누적 격자에서 다시 계산 (가로 커널 -> 세로 커널)
+    void blur(const QRect &region)
+    {
+        const QRect area = region.intersected(QRect(QPoint(0, 0), size));
+        if (area.isEmpty()) {
+            return;
+        }
+        
+        // 화면 x는 격자 x + R, 커널 k번째 칸은 격자 x + k
+        const int width = gridWidth();
+        const int taps = 2 * kernelRadius + 1;
+        const std::size_t rowWidth = static_cast<std::size_t>(area.width());
+        const int rows = area.height() + 2 * kernelRadius;
+        std::vector<float> horizontal(static_cast<std::size_t>(rows) * rowWidth, 0.0f);
+        for (int r = 0; r < rows; ++r) {
+            const float *in = &binned[static_cast<std::size_t>(area.top() + r) * width + area.left()];
+            float *out = &horizontal[static_cast<std::size_t>(r) * rowWidth];
+            for (int k = 0; k < taps; ++k) {
+                addScaled(out, in + k, rowWidth, kernel[static_cast<std::size_t>(k)]);
+            }
+        }
+        
+        for (int y = area.top(); y <= area.bottom(); ++y) {
+            float *out = &density[static_cast<std::size_t>(y) * size.width() + area.left()];
+            std::fill(out, out + rowWidth, 0.0f);
+            for (int k = 0; k < taps; ++k) {
+                addScaled(out, &horizontal[static_cast<std::size_t>(y - area.top() + k) * rowWidth], rowWidth,
+                          kernel[static_cast<std::size_t>(k)]);
+            }
+        }
+    }
+    
+    QImage colorize() const
+    {
+        QImage image(size, QImage::Format_ARGB32_Premultiplied);
+        const float maximum = maximumDensity > 0.0 ? static_cast<float>(maximumDensity)
+                                                   : maximumOf(density.data(), density.size());
+        if (maximum <= 0.0f) {
+            image.fill(Qt::transparent);
+            return image;
+        }
+        
+        const float scale = 255.0f / maximum;
+        for (int y = 0; y < size.height(); ++y) {
+            const float *values = &density[static_cast<std::size_t>(y) * size.width()];
+            QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+            for (int x = 0; x < size.width(); ++x) {
+                line[x] = palette[std::min(255, static_cast<int>(values[x] * scale))];
+            }
+        }
+        return image;
+    }
+};
+
+HGISHeatmapRenderer::HGISHeatmapRenderer()
+    : d(std::make_unique<Private>())
+{
+    d->updateKernel();
+    d->updatePalette();
+}
+
+HGISHeatmapRenderer::~HGISHeatmapRenderer() = default;
+
+double HGISHeatmapRenderer::radius() const
+{
+    return d->radius;
+}
+
+void HGISHeatmapRenderer::setRadius(double pixels)
+{
+    d->radius = std::max(1.0, pixels);
+    d->updateKernel();
+    d->valid = false;
+}
+
+QGradientStops HGISHeatmapRenderer::colorRamp() const
+{
+    return d->colorRamp;
+}
+
+void HGISHeatmapRenderer::setColorRamp(const QGradientStops &stops)
+{
+    d->colorRamp = stops;
+    std::sort(d->colorRamp.begin(), d->colorRamp.end(), [](const QGradientStop &a, const QGradientStop &b) {
+        return a.first < b.first;
+    });
+    d->updatePalette();
+}
+
+QGradientStops HGISHeatmapRenderer::defaultColorRamp()
+{
+    // 투명한 파랑 -> 청록 -> 연두 -> 노랑 -> 빨강
+    QGradientStops stops;
+    stops << QGradientStop(0.0, QColor(0, 0, 255, 0))
+          << QGradientStop(0.2, QColor(0, 0, 255, 120))
+          << QGradientStop(0.4, QColor(0, 255, 255, 160))
+          << QGradientStop(0.6, QColor(0, 255, 0, 190))
+          << QGradientStop(0.8, QColor(255, 255, 0, 220))
+          << QGradientStop(1.0, QColor(255, 0, 0, 240));
+    return stops;
+}
+
+double HGISHeatmapRenderer::maximumDensity() const
+{
+    return d->maximumDensity;
+}
+
+void HGISHeatmapRenderer::setMaximumDensity(double density)
+{
+    d->maximumDensity = std::max(0.0, density);
+}
+
+void HGISHeatmapRenderer::setPoints(const std::vector<QPointF> &points, const std::vector<float> &weights)
+{
+    d->xs.resize(points.size());
+    d->ys.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        d->xs[i] = points[i].x();
+        d->ys[i] = points[i].y();
+    }
+    d->weights = weights;
+    d->weights.resize(points.size(), 1.0f);
+    d->valid = false;
+}
+
+std::size_t HGISHeatmapRenderer::pointCount() const
+{
+    return d->xs.size();
+}
+
+QImage HGISHeatmapRenderer::render(const QTransform &toDevice, const QSize &size)
+{
+    if (size.isEmpty()) {
+        return QImage();
+    }
+    
+    // 직전과 축척이 같고 정수 픽셀만큼 이동했으면 겹치는 부분을 재사용
+    int shiftX = 0;
+    int shiftY = 0;
+    bool incremental = false;
+    if (d->valid && size == d->size
+        && qFuzzyCompare(toDevice.m11(), d->transform.m11()) && qFuzzyCompare(toDevice.m22(), d->transform.m22())
+        && qFuzzyCompare(1.0 + toDevice.m12(), 1.0 + d->transform.m12())
+        && qFuzzyCompare(1.0 + toDevice.m21(), 1.0 + d->transform.m21())) {
+        const double dx = toDevice.dx() - d->transform.dx();
+        const double dy = toDevice.dy() - d->transform.dy();
+        shiftX = qRound(dx);
+        shiftY = qRound(dy);
+        incremental = std::abs(dx - shiftX) < 1e-3 && std::abs(dy - shiftY) < 1e-3
+                      && std::abs(shiftX) < size.width() && std::abs(shiftY) < size.height();
+    }
+    
+    if (incremental && (shiftX != 0 || shiftY != 0)) {
+        const int width = d->gridWidth();
+        const int height = d->gridHeight();
+        shiftGrid(d->binned, width, height, shiftX, shiftY);
+        shiftGrid(d->density, size.width(), size.height(), shiftX, shiftY);
+        
+        // 새로 드러난 띠 (격자 좌표, 화면 좌표)
+        QVector<QRect> gridStrips;
+        QVector<QRect> screenStrips;
+        if (shiftX > 0) {
+            gridStrips << QRect(0, 0, shiftX, height);
+            screenStrips << QRect(0, 0, shiftX, size.height());
+        } else if (shiftX < 0) {
+            gridStrips << QRect(width + shiftX, 0, -shiftX, height);
+            screenStrips << QRect(size.width() + shiftX, 0, -shiftX, size.height());
+        }
+        if (shiftY > 0) {
+            gridStrips << QRect(0, 0, width, shiftY);
+            screenStrips << QRect(0, 0, size.width(), shiftY);
+        } else if (shiftY < 0) {
+            gridStrips << QRect(0, height + shiftY, width, -shiftY);
+            screenStrips << QRect(0, size.height() + shiftY, size.width(), -shiftY);
+        }
+        
+        d->transform = toDevice;
+        d->bin(toDevice, gridStrips);
+        for (const QRect &strip : screenStrips) {
+            d->blur(strip);
+        }
+    } else if (!incremental) {
+        d->size = size;
+        d->transform = toDevice;
+        d->binned.assign(static_cast<std::size_t>(d->gridWidth()) * d->gridHeight(), 0.0f);
+        d->density.assign(static_cast<std::size_t>(size.width()) * size.height(), 0.0f);
+        d->bin(toDevice, QVector<QRect>());
+        d->blur(QRect(QPoint(0, 0), size));
+        d->valid = true;
+    }
+    
+    return d->colorize();
+}
+
+void HGISHeatmapRenderer::invalidate()
+{
+    d->valid = false;
+}
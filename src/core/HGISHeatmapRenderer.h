@@ -0,0 +1,60 @@
+#ifndef HGISHEATMAPRENDERER_H
+#define HGISHEATMAPRENDERER_H
+
+#include <QGradient>
+#include <QImage>
+#include <QPointF>
+#include <QSize>
+#include <QTransform>
+#include <memory>
+#include <vector>
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+// 점 밀도 열 지도 (커널 밀도)
+// 점 가중치를 화면 해상도 float 격자에 모은 뒤 분리 가능한 가우스 커널(가로, 세로)로 흐리게 하고 색상 단계를 입힘
+// 격자는 커널 반경만큼 화면 밖까지 넓혀 두어 가장자리 밀도도 정확하고,
+// 직전과 축척이 같고 정수 픽셀만큼만 이동했으면 (끌어서 이동) 격자를 옮기고 새로 드러난 띠만 다시 계산
+// 투영, 커널 누적, 최대값은 벡터화한 루프 (HGISTransverseMercator와 같은 방식으로 AVX2/기본 버전 선택)
+class CORE_EXPORT HGISHeatmapRenderer
+{
+public:
+    HGISHeatmapRenderer();
+    ~HGISHeatmapRenderer();
+    
+    // 커널 반경 (화면 픽셀, 기본 20)
+    double radius() const;
+    void setRadius(double pixels);
+    
+    // 색상 단계 (0 = 밀도 없음, 1 = 최대 밀도, 투명도 포함)
+    QGradientStops colorRamp() const;
+    void setColorRamp(const QGradientStops &stops);
+    static QGradientStops defaultColorRamp();
+    
+    // 색상 단계의 최대 밀도 (0이면 화면 안 최대값)
+    double maximumDensity() const;
+    void setMaximumDensity(double density);
+    
+    // 점 (지도 좌표)과 가중치 - 바꾸면 누적 격자를 처음부터 다시 만듦
+    void setPoints(const std::vector<QPointF> &points, const std::vector<float> &weights);
+    std::size_t pointCount() const;
+    
+    // 지도 -> 화면 변환 toDevice, 화면 크기 size 의 밀도 이미지 (ARGB32 premultiplied)
+    QImage render(const QTransform &toDevice, const QSize &size);
+    
+    // 누적 격자 버리기 (다음 render는 전체 계산)
+    void invalidate();
+    
+private:
+    HGISHeatmapRenderer(const HGISHeatmapRenderer &) = delete;
+    HGISHeatmapRenderer &operator=(const HGISHeatmapRenderer &) = delete;
+    
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+#endif // HGISHEATMAPRENDERER_H
@@ -0,0 +1,250 @@
+#include "HGISPointClusterIndex.h"
+#include <QHash>
+#include <QThread>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+// 가장 큰 반경 = 전체 범위 긴 변 / 4, 이후 반씩 줄여 최대 20단계
+constexpr double kTopRadiusRatio = 0.25;
+constexpr int kMaxLevels = 20;
+
+struct ClusterLevel
+{
+    double radius = 0.0;
+    QVector<HGISPointCluster> clusters;
+};
+
+// 반경 크기 격자 칸 키
+inline quint64 cellKey(qint64 column, qint64 row)
+{
+    return (static_cast<quint64>(static_cast<quint32>(column)) << 32) | static_cast<quint32>(row);
+}
+
+// 아래 단계 군집을 반경 radius로 다시 묶음
+QVector<HGISPointCluster> mergeClusters(const QVector<HGISPointCluster> &input, double radius, const QPointF &origin)
+{
+    QHash<quint64, QVector<int>> grid;
+    grid.reserve(input.size());
+    for (int i = 0; i < input.size(); ++i) {
+        const qint64 column = static_cast<qint64>(std::floor((input[i].center.x() - origin.x()) / radius));
+        const qint64 row = static_cast<qint64>(std::floor((input[i].center.y() - origin.y()) / radius));
+        grid[cellKey(column, row)].append(i);
+    }
+    
+    const double radius2 = radius * radius;
+    std::vector<bool> merged(static_cast<std::size_t>(input.size()), false);
+    QVector<HGISPointCluster> output;
+    for (int i = 0; i < input.size(); ++i) {
+        if (merged[i]) {
+            continue;
+        }
+        merged[i] = true;
+        
+        const QPointF center = input[i].center;
+        double sumX = center.x() * input[i].count;
+        double sumY = center.y() * input[i].count;
+        HGISPointCluster cluster = input[i];
+        
+        // 반경이 칸 크기와 같으므로 둘레 3 x 3 칸만 보면 됨
+        const qint64 column = static_cast<qint64>(std::floor((center.x() - origin.x()) / radius));
+        const qint64 row = static_cast<qint64>(std::floor((center.y() - origin.y()) / radius));
+        for (qint64 dx = -1; dx <= 1; ++dx) {
+            for (qint64 dy = -1; dy <= 1; ++dy) {
+                auto it = grid.constFind(cellKey(column + dx, row + dy));
+                if (it == grid.constEnd()) {
+                    continue;
+                }
+                for (int j : it.value()) {
+                    if (merged[j]) {
+                        continue;
+                    }
+                    const QPointF delta = input[j].center - center;
+                    if (delta.x() * delta.x() + delta.y() * delta.y() > radius2) {
+                        continue;
+                    }
+                    merged[j] = true;
+                    sumX += input[j].center.x() * input[j].count;
+                    sumY += input[j].center.y() * input[j].count;
+                    cluster.count += input[j].count;
+                }
+            }
+        }
+        
+        if (cluster.count > input[i].count) {
+            cluster.center = QPointF(sumX / cluster.count, sumY / cluster.count);
+            cluster.featureId = -1;
+        }
+        output.append(cluster);
+    }
+    return output;
+}
+}
+
+class HGISPointClusterIndex::Private
+{
+public:
+    std::shared_ptr<const QVector<ClusterLevel>> levels;    // 생성 전에는 nullptr
+    int generation = 0;
+    bool building = false;
+    
+    // 스냅샷의 점으로 계층 생성 (작업 스레드에서 호출 가능)
+    static std::shared_ptr<const QVector<ClusterLevel>> buildLevels(const HGISFeatureSnapshot &snapshot)
+    {
+        auto levels = std::make_shared<QVector<ClusterLevel>>();
+        const HGISGeometryStore *store = snapshot.geometryStore();
+        if (!store) {
+            return levels;
+        }
+        
+        // 피처마다 범위 중심 하나 (다중 점은 중심으로)
+        QVector<HGISPointCluster> points;
+        points.reserve(static_cast<int>(snapshot.size()));
+        double minX = std::numeric_limits<double>::max();
+        double minY = std::numeric_limits<double>::max();
+        double maxX = -std::numeric_limits<double>::max();
+        double maxY = -std::numeric_limits<double>::max();
+        for (std::size_t row = 0; row < snapshot.size(); ++row) {
+            if (store->pointCount(row) == 0) {
+                continue;
+            }
+            HGISPointCluster point;
+            point.center = store->bounds(row).center();
+            point.count = 1;
+            point.featureId = snapshot[row].id;
+            points.append(point);
+            minX = std::min(minX, point.center.x());
+            minY = std::min(minY, point.center.y());
+            maxX = std::max(maxX, point.center.x());
+            maxY = std::max(maxY, point.center.y());
+        }
+        if (points.size() < 2) {
+            return levels;
+        }
+        
+        const double span = std::max(maxX - minX, maxY - minY);
+        if (span <= 0.0) {
+            return levels;
+        }
+        
+        // 작은 반경부터 묶어 올라감 - 아무것도 묶이지 않는 아래 단계는 개별 점과 같으므로 두지 않음
+        const QPointF origin(minX, minY);
+        QVector<HGISPointCluster> current = points;
+        for (int i = kMaxLevels - 1; i >= 0; --i) {
+            const double radius = span * kTopRadiusRatio / std::pow(2.0, i);
+            QVector<HGISPointCluster> next = mergeClusters(current, radius, origin);
+            if (levels->isEmpty() && next.size() == points.size()) {
+                continue;
+            }
+            
+            ClusterLevel level;
+            level.radius = radius;
+            level.clusters = next;
+            levels->append(level);
+            current.swap(next);
+        }
+        return levels;
+    }
+};
+
+HGISPointClusterIndex::HGISPointClusterIndex(QObject *parent)
+    : QObject(parent)
+    , d(std::make_unique<Private>())
+{
+}
+
+HGISPointClusterIndex::~HGISPointClusterIndex() = default;
+
+void HGISPointClusterIndex::buildInBackground(const HGISFeatureSnapshot &snapshot)
+{
+    const int generation = ++d->generation;
+    d->building = true;
+    
+    // 결과는 작업 스레드가 끝난 뒤 색인이 속한 스레드에서 교체
+    auto result = std::make_shared<std::shared_ptr<const QVector<ClusterLevel>>>();
+    QThread *thread = QThread::create([result, snapshot]() {
+        *result = Private::buildLevels(snapshot);
+    });
+    
+    connect(thread, &QThread::finished, this, [this, result, generation]() {
+        if (generation != d->generation) {
+            return;     // 더 새로운 생성 요청이 있음
+        }
+        d->levels = *result;
+        d->building = false;
+        emit ready();
+    });
+    connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+    thread->start(QThread::LowPriority);
+}
+
+void HGISPointClusterIndex::build(const HGISFeatureSnapshot &snapshot)
+{
+    ++d->generation;
+    d->building = false;
+    d->levels = Private::buildLevels(snapshot);
+    emit ready();
+}
+
+void HGISPointClusterIndex::clear()
+{
+    ++d->generation;
+    d->building = false;
+    d->levels.reset();
+}
+
+bool HGISPointClusterIndex::isReady() const
+{
+    return d->levels != nullptr;
+}
+
+bool HGISPointClusterIndex::isBuilding() const
+{
+    return d->building;
+}
+
+int HGISPointClusterIndex::levelCount() const
+{
+    return d->levels ? d->levels->size() : 0;
+}
+
+double HGISPointClusterIndex::levelRadius(int level) const
+{
+    return d->levels && level >= 0 && level < d->levels->size() ? d->levels->at(level).radius : 0.0;
+}
+
+int HGISPointClusterIndex::levelForRadius(double radius) const
+{
+    if (!d->levels) {
+        return -1;
+    }
+    
+    // 반경이 radius를 넘지 않는 가장 큰 단계
+    int result = -1;
+    for (int level = 0; level < d->levels->size(); ++level) {
+        if (d->levels->at(level).radius <= radius) {
+            result = level;
+        }
+    }
+    return result;
+}
+
+QVector<HGISPointCluster> HGISPointClusterIndex::clusters(int level, const QRectF &extent) const
+{
+    QVector<HGISPointCluster> result;
+    if (!d->levels || level < 0 || level >= d->levels->size()) {
+        return result;
+    }
+    
+    const QRectF rect = extent.normalized();
+    for (const HGISPointCluster &cluster : d->levels->at(level).clusters) {
+        const QPointF &center = cluster.center;
+        if (center.x() >= rect.left() && center.x() <= rect.right()
+            && center.y() >= rect.top() && center.y() <= rect.bottom()) {
+            result.append(cluster);
+        }
+    }
+    return result;
+}
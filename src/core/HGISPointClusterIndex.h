@@ -0,0 +1,64 @@
+#ifndef HGISPOINTCLUSTERINDEX_H
+#define HGISPOINTCLUSTERINDEX_H
+
+#include <QObject>
+#include <QPointF>
+#include <QRectF>
+#include <QVector>
+#include <memory>
+#include "HGISFeatureSnapshot.h"
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+// 점 군집 하나 (레이어 좌표계)
+struct HGISPointCluster
+{
+    QPointF center;             // 포함한 점들의 평균 위치
+    long count = 0;             // 점 (피처) 수
+    long featureId = -1;        // 점 하나뿐이면 그 피처 ID, 아니면 -1
+};
+
+// 축척별 점 군집 계층 (supercluster와 같은 방식)
+// 가장 작은 반경 단계부터 반경을 두 배씩 키우며 아래 단계의 군집을 다시 묶음
+// 각 단계는 아직 묶이지 않은 군집을 중심으로 반경 안의 군집을 흡수 (반경 크기 격자로 이웃 검색)
+// 한 번 만들면 모든 축척에서 재사용하고, 화면 반경에 맞는 단계를 골라 그림
+// 생성은 피처 스냅샷을 받아 백그라운드 스레드에서 함 (스냅샷은 불변이라 그대로 넘김)
+class CORE_EXPORT HGISPointClusterIndex : public QObject
+{
+    Q_OBJECT
+    
+public:
+    explicit HGISPointClusterIndex(QObject *parent = nullptr);
+    ~HGISPointClusterIndex();
+    
+    // 백그라운드 생성 (생성 중에 다시 호출하면 이전 결과는 버림)
+    void buildInBackground(const HGISFeatureSnapshot &snapshot);
+    void build(const HGISFeatureSnapshot &snapshot);
+    void clear();
+    
+    bool isReady() const;
+    bool isBuilding() const;
+    
+    // 단계 (0 = 반경이 가장 작은 단계)
+    int levelCount() const;
+    double levelRadius(int level) const;        // 레이어 단위
+    
+    // 군집 반경 radius (레이어 단위)에 맞는 단계 - 가장 작은 단계보다 작으면 -1 (개별 점으로 그림)
+    int levelForRadius(double radius) const;
+    
+    // 단계 level에서 중심이 extent 안에 있는 군집
+    QVector<HGISPointCluster> clusters(int level, const QRectF &extent) const;
+    
+signals:
+    void ready();
+    
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+#endif // HGISPOINTCLUSTERINDEX_H
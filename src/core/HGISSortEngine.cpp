@@ -0,0 +1,685 @@
+#include "HGISSortEngine.h"
+#include "HGISWorkerPool.h"
+#include <QCollator>
+#include <QCollatorSortKey>
+#include <QHash>
+#include <QLocale>
+#include <QThread>
+#include <ogr_api.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <limits>
+#include <numeric>
+
+namespace
+{
+constexpr std::size_t kReadBatchSize = 8192;
+constexpr int kRadixBits = 16;
+constexpr std::size_t kRadixBuckets = std::size_t(1) << kRadixBits;
+constexpr quint64 kSignBit = Q_UINT64_C(0x8000000000000000);
+
+// 정렬/그룹에 필요한 필드만 뽑은 열 (행 = 피처, NULL은 무효 QVariant)
+struct ColumnTable
+{
+    std::vector<qint64> fids;
+    std::vector<std::vector<QVariant>> columns;
+};
+
+bool isNumber(const QVariant &value)
+{
+    switch (value.type()) {
+        case QVariant::Int:
+        case QVariant::UInt:
+        case QVariant::LongLong:
+        case QVariant::ULongLong:
+        case QVariant::Double:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool isNull(const QVariant &value)
+{
+    return !value.isValid() || value.isNull();
+}
+
+int resolveThreadCount(const HGISSortOptions &options, std::size_t rows)
+{
+    if (rows < static_cast<std::size_t>(qMax(0, options.parallelThreshold))) {
+        return 1;
+    }
+    return options.threadCount > 0 ? options.threadCount : qMax(1, QThread::idealThreadCount());
+}
+
+int chunkCount(std::size_t rows, int threads)
+{
+    return static_cast<int>(std::max<std::size_t>(1, std::min<std::size_t>(threads, rows)));
+}
+
+// [0, count)를 parts개 구간으로 나눠 동시에 처리 (첫 구간은 호출 스레드, 나머지는 전역 작업 스레드 풀)
+// 기수 정렬은 자리마다 여러 번 부르므로 구간마다 스레드를 만들지 않음
+// 같은 count/parts면 항상 같은 구간으로 나뉨
+void parallelChunks(std::size_t count, int parts,
+                    const std::function<void(int part, std::size_t begin, std::size_t end)> &work)
+{
+    const std::size_t chunk = (count + parts - 1) / parts;
+    std::vector<std::future<void>> futures;
+    for (int part = 1; part < parts; ++part) {
+        const std::size_t begin = std::min(count, part * chunk);
+        const std::size_t end = std::min(count, begin + chunk);
+        futures.push_back(HGISWorkerPool::globalInstance().submit([&work, part, begin, end](int) {
+            work(part, begin, end);
+        }));
+    }
+    work(0, 0, std::min(count, chunk));
+    for (std::future<void> &future : futures) {
+        future.get();
+    }
+}
+
+// 부호 없는 정수 비교가 원래 값의 순서와 같도록 변환
+quint64 orderedBits(qint64 value)
+{
+    return static_cast<quint64>(value) ^ kSignBit;
+}
+
+quint64 orderedBits(double value)
+{
+    if (std::isnan(value)) {
+        return std::numeric_limits<quint64>::max();
+    }
+    if (value == 0.0) {
+        value = 0.0;    // -0 과 +0 을 같게
+    }
+    quint64 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & kSignBit) ? ~bits : (bits | kSignBit);
+}
+
+// 한국어 정렬 규칙 (가나다순, 대소문자 무시, "2호" < "10호")
+QCollator koreanCollator()
+{
+    QCollator collator(QLocale(QLocale::Korean, QLocale::SouthKorea));
+    collator.setCaseSensitivity(Qt::CaseInsensitive);
+    collator.setNumericMode(true);
+    return collator;
+}
+
+// 정렬 키 열 하나 (오름차순 비교, NULL은 마지막)
+struct KeyColumn
+{
+    bool numeric = true;
+    bool descending = false;
+    std::vector<quint8> nulls;
+    std::vector<quint64> numbers;               // 숫자 열
+    std::vector<QCollatorSortKey> texts;        // 문자열 열 (NULL 행은 빈 문자열 키)
+    
+    int compare(quint32 a, quint32 b) const
+    {
+        if (nulls[a] != nulls[b]) {
+            return nulls[a] ? 1 : -1;
+        }
+        if (nulls[a]) {
+            return 0;
+        }
+        if (numeric) {
+            return numbers[a] < numbers[b] ? -1 : (numbers[a] > numbers[b] ? 1 : 0);
+        }
+        return texts[a].compare(texts[b]);
+    }
+};
+
+KeyColumn makeKeyColumn(const std::vector<QVariant> &values, bool descending, int threads)
+{
+    KeyColumn column;
+    column.descending = descending;
+    
+    const std::size_t count = values.size();
+    column.nulls.resize(count);
+    bool integral = true;
+    for (std::size_t i = 0; i < count; ++i) {
+        const QVariant &value = values[i];
+        column.nulls[i] = isNull(value) ? 1 : 0;
+        if (!column.nulls[i]) {
+            if (!isNumber(value)) {
+                column.numeric = false;
+            } else if (value.type() == QVariant::Double) {
+                integral = false;
+            }
+        }
+    }
+    
+    const int parts = chunkCount(count, threads);
+    
+    if (column.numeric) {
+        // 정수만 있으면 64비트 정수 그대로, 실수가 섞이면 double 비트 순서로
+        column.numbers.resize(count);
+        parallelChunks(count, parts, [&](int, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                if (column.nulls[i]) {
+                    column.numbers[i] = 0;
+                } else if (integral) {
+                    column.numbers[i] = orderedBits(static_cast<qint64>(values[i].toLongLong()));
+                } else {
+                    column.numbers[i] = orderedBits(values[i].toDouble());
+                }
+            }
+        });
+        return column;
+    }
+    
+    // 정렬 키 생성이 비교보다 훨씬 비싸므로 구간별로 나눠 만들고 순서대로 이어 붙임
+    // QCollator는 스레드마다 따로 생성
+    std::vector<std::vector<QCollatorSortKey>> partKeys(parts);
+    parallelChunks(count, parts, [&](int part, std::size_t begin, std::size_t end) {
+        const QCollator collator = koreanCollator();
+        std::vector<QCollatorSortKey> &keys = partKeys[part];
+        keys.reserve(end - begin);
+        for (std::size_t i = begin; i < end; ++i) {
+            keys.push_back(collator.sortKey(column.nulls[i] ? QString() : values[i].toString()));
+        }
+    });
+    
+    column.texts.reserve(count);
+    for (std::vector<QCollatorSortKey> &keys : partKeys) {
+        for (QCollatorSortKey &key : keys) {
+            column.texts.push_back(std::move(key));
+        }
+    }
+    return column;
+}
+
+// (키, 행) 안정 LSD 기수 정렬
+// 구간별 자릿값 도수 -> (자릿값, 구간) 순 누적 위치 -> 구간별 분배를 자리마다 반복
+// 모든 키의 자릿값이 같은 자리는 건너뜀 (작은 정수 열은 보통 한두 번으로 끝남)
+void radixSort(std::vector<quint64> &keys, std::vector<quint32> &rows, int threads)
+{
+    const std::size_t count = keys.size();
+    if (count < kRadixBuckets / 16) {
+        std::vector<quint32> order(count);
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(), [&keys](quint32 a, quint32 b) {
+            return keys[a] < keys[b];
+        });
+        std::vector<quint32> sorted(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            sorted[i] = rows[order[i]];
+        }
+        rows.swap(sorted);
+        return;
+    }
+    
+    const int parts = chunkCount(count, threads);
+    std::vector<std::vector<std::size_t>> positions(parts, std::vector<std::size_t>(kRadixBuckets));
+    std::vector<quint64> keyBuffer(count);
+    std::vector<quint32> rowBuffer(count);
+    
+    for (int shift = 0; shift < 64; shift += kRadixBits) {
+        parallelChunks(count, parts, [&](int part, std::size_t begin, std::size_t end) {
+            std::vector<std::size_t> &histogram = positions[part];
+            std::fill(histogram.begin(), histogram.end(), 0);
+            for (std::size_t i = begin; i < end; ++i) {
+                ++histogram[(keys[i] >> shift) & (kRadixBuckets - 1)];
+            }
+        });
+        
+        bool uniform = false;
+        std::size_t offset = 0;
+        for (std::size_t digit = 0; digit < kRadixBuckets && !uniform; ++digit) {
+            std::size_t digitTotal = 0;
+            for (int part = 0; part < parts; ++part) {
+                const std::size_t digitCount = positions[part][digit];
+                positions[part][digit] = offset;
+                offset += digitCount;
+                digitTotal += digitCount;
+            }
+            uniform = (digitTotal == count);
+        }
+        if (uniform) {
+            continue;
+        }
+        
+        parallelChunks(count, parts, [&](int part, std::size_t begin, std::size_t end) {
+            std::vector<std::size_t> &position = positions[part];
+            for (std::size_t i = begin; i < end; ++i) {
+                const std::size_t target = position[(keys[i] >> shift) & (kRadixBuckets - 1)]++;
+                keyBuffer[target] = keys[i];
+                rowBuffer[target] = rows[i];
+            }
+        });
+        keys.swap(keyBuffer);
+        rows.swap(rowBuffer);
+    }
+}
+
+// 구간별 안정 정렬 후 이웃한 구간끼리 병렬로 병합 (std::merge는 같은 값이면 앞 구간 먼저)
+template <typename Less>
+void parallelMergeSort(std::vector<quint32> &rows, const Less &less, int threads)
+{
+    const std::size_t count = rows.size();
+    const int parts = chunkCount(count, threads);
+    if (parts <= 1) {
+        std::stable_sort(rows.begin(), rows.end(), less);
+        return;
+    }
+    
+    const std::size_t chunk = (count + parts - 1) / parts;
+    std::vector<std::size_t> bounds(parts + 1);
+    for (int part = 0; part <= parts; ++part) {
+        bounds[part] = std::min(count, part * chunk);
+    }
+    
+    parallelChunks(count, parts, [&](int, std::size_t begin, std::size_t end) {
+        std::stable_sort(rows.begin() + begin, rows.begin() + end, less);
+    });
+    
+    std::vector<quint32> buffer(count);
+    while (bounds.size() > 2) {
+        const std::size_t runs = bounds.size() - 1;
+        std::vector<std::future<void>> merges;
+        for (std::size_t run = 0; run + 1 < runs; run += 2) {
+            const std::size_t first = bounds[run];
+            const std::size_t middle = bounds[run + 1];
+            const std::size_t last = bounds[run + 2];
+            merges.push_back(HGISWorkerPool::globalInstance().submit([&rows, &buffer, &less, first, middle, last](int) {
+                std::merge(rows.begin() + first, rows.begin() + middle,
+                           rows.begin() + middle, rows.begin() + last,
+                           buffer.begin() + first, less);
+            }));
+        }
+        if (runs % 2 == 1) {
+            std::copy(rows.begin() + bounds[runs - 1], rows.end(), buffer.begin() + bounds[runs - 1]);
+        }
+        for (std::future<void> &merge : merges) {
+            merge.get();
+        }
+        rows.swap(buffer);
+        
+        std::vector<std::size_t> merged;
+        for (std::size_t i = 0; i < bounds.size(); i += 2) {
+            merged.push_back(bounds[i]);
+        }
+        if (merged.back() != count) {
+            merged.push_back(count);
+        }
+        bounds.swap(merged);
+    }
+}
+
+QVector<long> sortTable(const ColumnTable &table, const QVector<HGISSortKey> &keys,
+                        const HGISSortOptions &options)
+{
+    const std::size_t count = table.fids.size();
+    const int threads = resolveThreadCount(options, count);
+    
+    std::vector<KeyColumn> columns;
+    columns.reserve(keys.size());
+    for (int k = 0; k < keys.size(); ++k) {
+        columns.push_back(makeKeyColumn(table.columns[k], keys[k].descending, threads));
+    }
+    
+    std::vector<quint32> rows;
+    if (columns.size() == 1 && columns.front().numeric) {
+        // NULL이 아닌 행만 기수 정렬하고 NULL 행은 원래 순서로 뒤(내림차순이면 앞)에 붙임
+        const KeyColumn &column = columns.front();
+        std::vector<quint64> sortKeys;
+        std::vector<quint32> valueRows;
+        std::vector<quint32> nullRows;
+        sortKeys.reserve(count);
+        valueRows.reserve(count);
+        for (std::size_t row = 0; row < count; ++row) {
+            if (column.nulls[row]) {
+                nullRows.push_back(static_cast<quint32>(row));
+            } else {
+                valueRows.push_back(static_cast<quint32>(row));
+                sortKeys.push_back(column.descending ? ~column.numbers[row] : column.numbers[row]);
+            }
+        }
+        radixSort(sortKeys, valueRows, threads);
+        
+        rows.reserve(count);
+        if (column.descending) {
+            rows.insert(rows.end(), nullRows.begin(), nullRows.end());
+        }
+        rows.insert(rows.end(), valueRows.begin(), valueRows.end());
+        if (!column.descending) {
+            rows.insert(rows.end(), nullRows.begin(), nullRows.end());
+        }
+    } else {
+        rows.resize(count);
+        std::iota(rows.begin(), rows.end(), 0u);
+        if (!columns.empty()) {
+            parallelMergeSort(rows, [&columns](quint32 a, quint32 b) {
+                for (const KeyColumn &column : columns) {
+                    const int order = column.compare(a, b);
+                    if (order != 0) {
+                        return column.descending ? order > 0 : order < 0;
+                    }
+                }
+                return false;
+            }, threads);
+        }
+    }
+    
+    QVector<long> result;
+    result.reserve(static_cast<int>(count));
+    for (quint32 row : rows) {
+        result.append(static_cast<long>(table.fids[row]));
+    }
+    return result;
+}
+
+// 그룹 하나의 부분 집계
+struct GroupAccumulator
+{
+    QVariantList keys;
+    long count = 0;
+    std::vector<long> valueCounts;
+    std::vector<double> sums;
+    std::vector<double> minimums;
+    std::vector<double> maximums;
+    
+    explicit GroupAccumulator(int aggregateCount = 0)
+        : valueCounts(aggregateCount, 0)
+        , sums(aggregateCount, 0.0)
+        , minimums(aggregateCount, std::numeric_limits<double>::infinity())
+        , maximums(aggregateCount, -std::numeric_limits<double>::infinity())
+    {
+    }
+    
+    void add(const ColumnTable &table, int firstAggregate, std::size_t row)
+    {
+        ++count;
+        for (std::size_t a = 0; a < sums.size(); ++a) {
+            const QVariant &value = table.columns[firstAggregate + a][row];
+            if (isNull(value) || !isNumber(value)) {
+                continue;
+            }
+            const double number = value.toDouble();
+            ++valueCounts[a];
+            sums[a] += number;
+            minimums[a] = std::min(minimums[a], number);
+            maximums[a] = std::max(maximums[a], number);
+        }
+    }
+    
+    void merge(const GroupAccumulator &other)
+    {
+        count += other.count;
+        for (std::size_t a = 0; a < sums.size(); ++a) {
+            valueCounts[a] += other.valueCounts[a];
+            sums[a] += other.sums[a];
+            minimums[a] = std::min(minimums[a], other.minimums[a]);
+            maximums[a] = std::max(maximums[a], other.maximums[a]);
+        }
+    }
+};
+
+// 그룹 필드 값을 이어 붙인 해시 키 (숫자는 값으로 비교되도록 double 표현)
+QString groupKey(const ColumnTable &table, int groupCount, std::size_t row)
+{
+    QString key;
+    for (int g = 0; g < groupCount; ++g) {
+        const QVariant &value = table.columns[g][row];
+        if (g > 0) {
+            key += QChar(0x1f);
+        }
+        if (isNull(value)) {
+            key += QChar(0x1);
+        } else if (isNumber(value)) {
+            const double number = value.toDouble();
+            key += 'n' + QString::number(number == 0.0 ? 0.0 : number, 'g', 17);
+        } else {
+            key += 's' + value.toString();
+        }
+    }
+    return key;
+}
+
+// 그룹 키 비교 (숫자끼리는 값, 그 외는 한국어 정렬 규칙, NULL은 마지막)
+bool groupLess(const HGISGroup &a, const HGISGroup &b, const QCollator &collator)
+{
+    for (int i = 0; i < a.keys.size(); ++i) {
+        const QVariant &left = a.keys[i];
+        const QVariant &right = b.keys[i];
+        if (isNull(left) != isNull(right)) {
+            return isNull(right);
+        }
+        if (isNull(left)) {
+            continue;
+        }
+        int order;
+        if (isNumber(left) && isNumber(right)) {
+            const double x = left.toDouble();
+            const double y = right.toDouble();
+            order = x < y ? -1 : (x > y ? 1 : 0);
+        } else {
+            order = collator.compare(left.toString(), right.toString());
+        }
+        if (order != 0) {
+            return order < 0;
+        }
+    }
+    return false;
+}
+
+QVector<HGISGroup> groupTable(const ColumnTable &table, const QStringList &groupFields,
+                              const QStringList &aggregateFields, const HGISSortOptions &options)
+{
+    const std::size_t count = table.fids.size();
+    const int groupCount = groupFields.size();
+    const int aggregateCount = aggregateFields.size();
+    const int threads = resolveThreadCount(options, count);
+    const int parts = chunkCount(count, threads);
+    
+    // 구간마다 따로 해시 집계 후 첫 구간에 병합
+    std::vector<QHash<QString, GroupAccumulator>> partGroups(parts);
+    parallelChunks(count, parts, [&](int part, std::size_t begin, std::size_t end) {
+        QHash<QString, GroupAccumulator> &groups = partGroups[part];
+        for (std::size_t row = begin; row < end; ++row) {
+            const QString key = groupKey(table, groupCount, row);
+            auto it = groups.find(key);
+            if (it == groups.end()) {
+                GroupAccumulator accumulator(aggregateCount);
+                for (int g = 0; g < groupCount; ++g) {
+                    const QVariant &value = table.columns[g][row];
+                    accumulator.keys.append(isNull(value) ? QVariant() : value);
+                }
+                it = groups.insert(key, accumulator);
+            }
+            it->add(table, groupCount, row);
+        }
+    });
+    
+    QHash<QString, GroupAccumulator> &merged = partGroups.front();
+    for (int part = 1; part < parts; ++part) {
+        for (auto it = partGroups[part].constBegin(); it != partGroups[part].constEnd(); ++it) {
+            auto target = merged.find(it.key());
+            if (target == merged.end()) {
+                merged.insert(it.key(), it.value());
+            } else {
+                target->merge(it.value());
+            }
+        }
+    }
+    
+    std::vector<HGISGroup> groups;
+    groups.reserve(merged.size());
+    for (const GroupAccumulator &accumulator : merged) {
+        HGISGroup group;
+        group.keys = accumulator.keys;
+        group.count = accumulator.count;
+        for (int a = 0; a < aggregateCount; ++a) {
+            const long values = accumulator.valueCounts[a];
+            const double nan = std::numeric_limits<double>::quiet_NaN();
+            group.valueCounts.append(values);
+            group.sums.append(accumulator.sums[a]);
+            group.minimums.append(values > 0 ? accumulator.minimums[a] : nan);
+            group.maximums.append(values > 0 ? accumulator.maximums[a] : nan);
+            group.means.append(values > 0 ? accumulator.sums[a] / values : nan);
+        }
+        groups.push_back(group);
+    }
+    
+    const QCollator collator = koreanCollator();
+    std::sort(groups.begin(), groups.end(), [&collator](const HGISGroup &a, const HGISGroup &b) {
+        return groupLess(a, b, collator);
+    });
+    
+    QVector<HGISGroup> result;
+    result.reserve(static_cast<int>(groups.size()));
+    for (HGISGroup &group : groups) {
+        result.append(std::move(group));
+    }
+    return result;
+}
+
+ColumnTable tableFromFeatures(const std::vector<HGISGdalProvider::Feature> &features,
+                              const QStringList &fieldNames, int threads)
+{
+    ColumnTable table;
+    const std::size_t count = features.size();
+    table.fids.resize(count);
+    table.columns.assign(fieldNames.size(), std::vector<QVariant>(count));
+    
+    parallelChunks(count, chunkCount(count, threads), [&](int, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            table.fids[i] = features[i].id;
+            for (int f = 0; f < fieldNames.size(); ++f) {
+                table.columns[f][i] = features[i].attributes.value(fieldNames[f]);
+            }
+        }
+    });
+    return table;
+}
+
+QVariant fieldValue(OGRFeatureH feature, int index, OGRFieldType type)
+{
+    if (!OGR_F_IsFieldSetAndNotNull(feature, index)) {
+        return QVariant();
+    }
+    switch (type) {
+        case OFTInteger:
+            return OGR_F_GetFieldAsInteger(feature, index);
+        case OFTInteger64:
+            return static_cast<qlonglong>(OGR_F_GetFieldAsInteger64(feature, index));
+        case OFTReal:
+            return OGR_F_GetFieldAsDouble(feature, index);
+        default:
+            return QString::fromUtf8(OGR_F_GetFieldAsString(feature, index));
+    }
+}
+
+// 제공자에서 필요한 필드만 읽어 열로 모음 (나머지 필드와 지오메트리는 OGR에서 무시)
+bool tableFromProvider(const HGISGdalProvider &provider, const QStringList &fieldNames, ColumnTable &table)
+{
+    OGRLayerH layer = provider.layerHandle();
+    if (!layer) {
+        qWarning() << "데이터 소스가 열려 있지 않습니다";
+        return false;
+    }
+    
+    OGRFeatureDefnH defn = OGR_L_GetLayerDefn(layer);
+    std::vector<int> indexes;
+    std::vector<OGRFieldType> types;
+    for (const QString &fieldName : fieldNames) {
+        const int index = OGR_FD_GetFieldIndex(defn, fieldName.toUtf8().constData());
+        if (index < 0) {
+            qWarning() << "필드를 찾을 수 없습니다:" << fieldName;
+            return false;
+        }
+        indexes.push_back(index);
+        types.push_back(OGR_Fld_GetType(OGR_FD_GetFieldDefn(defn, index)));
+    }
+    
+    QList<QByteArray> ignoredNames;
+    for (int i = 0; i < OGR_FD_GetFieldCount(defn); ++i) {
+        if (std::find(indexes.begin(), indexes.end(), i) == indexes.end()) {
+            ignoredNames.append(QByteArray(OGR_Fld_GetNameRef(OGR_FD_GetFieldDefn(defn, i))));
+        }
+    }
+    ignoredNames << "OGR_GEOMETRY" << "OGR_STYLE";
+    std::vector<const char *> ignored;
+    for (const QByteArray &name : ignoredNames) {
+        ignored.push_back(name.constData());
+    }
+    ignored.push_back(nullptr);
+    OGR_L_SetIgnoredFields(layer, ignored.data());
+    
+    const std::size_t expected = static_cast<std::size_t>(qMax(0L, provider.featureCount()));
+    table.fids.reserve(expected);
+    table.columns.assign(fieldNames.size(), std::vector<QVariant>());
+    for (std::vector<QVariant> &column : table.columns) {
+        column.reserve(expected);
+    }
+    
+    const long read = provider.readFeatureBatches(kReadBatchSize, [&](std::vector<OGRFeatureH> &batch) {
+        for (OGRFeatureH feature : batch) {
+            table.fids.push_back(OGR_F_GetFID(feature));
+            for (std::size_t f = 0; f < indexes.size(); ++f) {
+                table.columns[f].push_back(fieldValue(feature, indexes[f], types[f]));
+            }
+            OGR_F_Destroy(feature);
+        }
+        return true;
+    });
+    
+    OGR_L_SetIgnoredFields(layer, nullptr);
+    return read >= 0;
+}
+
+QStringList keyFieldNames(const QVector<HGISSortKey> &keys)
+{
+    QStringList fieldNames;
+    for (const HGISSortKey &key : keys) {
+        fieldNames << key.fieldName;
+    }
+    return fieldNames;
+}
+}
+
+QVector<long> HGISSortEngine::sortFeatureIds(const std::vector<HGISGdalProvider::Feature> &features,
+                                             const QVector<HGISSortKey> &keys,
+                                             const Options &options)
+{
+    const ColumnTable table = tableFromFeatures(features, keyFieldNames(keys),
+                                                resolveThreadCount(options, features.size()));
+    return sortTable(table, keys, options);
+}
+
+QVector<long> HGISSortEngine::sortFeatureIds(const HGISGdalProvider &provider,
+                                             const QVector<HGISSortKey> &keys,
+                                             const Options &options)
+{
+    ColumnTable table;
+    if (!tableFromProvider(provider, keyFieldNames(keys), table)) {
+        return QVector<long>();
+    }
+    return sortTable(table, keys, options);
+}
+
+QVector<HGISGroup> HGISSortEngine::groupBy(const std::vector<HGISGdalProvider::Feature> &features,
+                                           const QStringList &groupFields,
+                                           const QStringList &aggregateFields,
+                                           const Options &options)
+{
+    const ColumnTable table = tableFromFeatures(features, groupFields + aggregateFields,
+                                                resolveThreadCount(options, features.size()));
+    return groupTable(table, groupFields, aggregateFields, options);
+}
+
+QVector<HGISGroup> HGISSortEngine::groupBy(const HGISGdalProvider &provider,
+                                           const QStringList &groupFields,
+                                           const QStringList &aggregateFields,
+                                           const Options &options)
+{
+    ColumnTable table;
+    if (!tableFromProvider(provider, groupFields + aggregateFields, table)) {
+        return QVector<HGISGroup>();
+    }
+    return groupTable(table, groupFields, aggregateFields, options);
+}
@@ -0,0 +1,77 @@
+#ifndef HGISSORTENGINE_H
+#define HGISSORTENGINE_H
+
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <QVector>
+#include <vector>
+#include "providers/HGISGdalProvider.h"
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+// 정렬 키 (필드 하나)
+struct HGISSortKey
+{
+    QString fieldName;
+    bool descending = false;
+};
+
+// 그룹 하나의 집계 (예: 시대 x 시군구 별 유적 수)
+struct HGISGroup
+{
+    QVariantList keys;          // 그룹 필드 값 (NULL은 무효 QVariant)
+    long count = 0;             // 피처 수
+    
+    // 집계 필드별 숫자 값 통계 (숫자 값이 없으면 합계 0, 나머지 NaN)
+    QVector<long> valueCounts;
+    QVector<double> sums;
+    QVector<double> minimums;
+    QVector<double> maximums;
+    QVector<double> means;
+};
+
+// 정렬/그룹 옵션
+struct HGISSortOptions
+{
+    int threadCount = 0;            // 0이면 CPU 코어 수
+    int parallelThreshold = 65536;  // 행 수가 이보다 적으면 호출 스레드에서 처리
+};
+
+// 속성 열 정렬과 그룹 집계
+// - 숫자 열 하나: 순서를 보존하는 64비트 키로 바꿔 병렬 LSD 기수 정렬 (16비트씩 최대 4회)
+// - 문자열 열/여러 열: 한국어 정렬 키(QCollator, 숫자 부분은 값 순서)를 병렬로 미리 만들고 병렬 병합 정렬
+// - 그룹: 스레드별 해시 집계를 병합하고 그룹 키 순서로 정렬
+// 같은 키는 원래 순서를 유지하고 (안정 정렬), NULL은 오름차순에서 마지막, 내림차순에서 처음
+class CORE_EXPORT HGISSortEngine
+{
+public:
+    using Options = HGISSortOptions;
+    
+    // 정렬된 피처 ID
+    static QVector<long> sortFeatureIds(const std::vector<HGISGdalProvider::Feature> &features,
+                                        const QVector<HGISSortKey> &keys,
+                                        const Options &options = Options());
+    
+    // 제공자에서 정렬 키 필드만 읽어 정렬 (지오메트리와 다른 필드는 읽지 않음)
+    static QVector<long> sortFeatureIds(const HGISGdalProvider &provider,
+                                        const QVector<HGISSortKey> &keys,
+                                        const Options &options = Options());
+    
+    // groupFields 값 조합별 피처 수와 aggregateFields 집계
+    static QVector<HGISGroup> groupBy(const std::vector<HGISGdalProvider::Feature> &features,
+                                      const QStringList &groupFields,
+                                      const QStringList &aggregateFields = QStringList(),
+                                      const Options &options = Options());
+    
+    static QVector<HGISGroup> groupBy(const HGISGdalProvider &provider,
+                                      const QStringList &groupFields,
+                                      const QStringList &aggregateFields = QStringList(),
+                                      const Options &options = Options());
+};
+
+#endif // HGISSORTENGINE_H
@@ -0,0 +1,570 @@
+#include "HGISStatisticsEngine.h"
+#include "HGISWorkerPool.h"
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QSet>
+#include <QThread>
+#include <ogr_api.h>
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <future>
+
+namespace
+{
+// 스레드 하나가 맡기에 너무 작은 구간은 나누지 않음
+constexpr std::size_t kMinChunkSize = 4096;
+
+// 필드 하나의 부분 집계 (스레드별로 만든 뒤 병합)
+struct Accumulator
+{
+    long count = 0;
+    long nullCount = 0;
+    long numericCount = 0;
+    double minimum = std::numeric_limits<double>::infinity();
+    double maximum = -std::numeric_limits<double>::infinity();
+    double sum = 0.0;
+    double mean = 0.0;
+    double m2 = 0.0;                // 편차 제곱합 (Welford)
+    QSet<double> numericValues;
+    QSet<QString> textValues;
+    HGISHyperLogLog distinct;
+    HGISSpaceSaving topValues;
+    bool keepUnique = false;
+    int maxUnique = 0;              // 고유값이 이보다 많으면 목록을 버리고 추정값만 (0이면 제한 없음)
+    bool uniqueOverflow = false;
+    bool trackTop = false;
+    
+    void addNull()
+    {
+        ++nullCount;
+    }
+    
+    void addNumber(double value)
+    {
+        if (std::isnan(value)) {
+            addNull();
+            return;
+        }
+        
+        ++count;
+        ++numericCount;
+        minimum = std::min(minimum, value);
+        maximum = std::max(maximum, value);
+        sum += value;
+        
+        const double delta = value - mean;
+        mean += delta / numericCount;
+        m2 += delta * (value - mean);
+        
+        addSketches(value);
+        if (keepUnique && !uniqueOverflow) {
+            numericValues.insert(value);
+            checkUniqueLimit();
+        }
+    }
+    
+    void addText(const QString &value)
+    {
+        ++count;
+        addSketches(value);
+        if (keepUnique && !uniqueOverflow) {
+            textValues.insert(value);
+            checkUniqueLimit();
+        }
+    }
+    
+    // 고유값 목록이 상한을 넘으면 버리고 HyperLogLog 추정으로 대신함 (메모리 상한)
+    void checkUniqueLimit()
+    {
+        if (maxUnique > 0 && numericValues.size() + textValues.size() > maxUnique) {
+            numericValues = QSet<double>();
+            textValues = QSet<QString>();
+            uniqueOverflow = true;
+        }
+    }
+    
+    void addSketches(const QVariant &value)
+    {
+        distinct.add(value);
+        if (trackTop) {
+            topValues.add(value);
+        }
+    }
+    
+    static bool isNumber(const QVariant &value)
+    {
+        switch (value.type()) {
+            case QVariant::Int:
+            case QVariant::UInt:
+            case QVariant::LongLong:
+            case QVariant::ULongLong:
+            case QVariant::Double:
+                return true;
+            default:
+                return false;
+        }
+    }
+    
+    void addVariant(const QVariant &value)
+    {
+        if (value.isNull()) {
+            addNull();
+        } else if (isNumber(value)) {
+            addNumber(value.toDouble());
+        } else {
+            addText(value.toString());
+        }
+    }
+    
+    // 병렬 분산 병합 (Chan et al.)
+    void merge(Accumulator &other)
+    {
+        if (other.numericCount > 0) {
+            const long total = numericCount + other.numericCount;
+            const double delta = other.mean - mean;
+            mean += delta * other.numericCount / total;
+            m2 += other.m2 + delta * delta * numericCount * other.numericCount / total;
+            numericCount = total;
+            minimum = std::min(minimum, other.minimum);
+            maximum = std::max(maximum, other.maximum);
+            sum += other.sum;
+        }
+        
+        count += other.count;
+        nullCount += other.nullCount;
+        
+        // 한쪽이라도 상한을 넘었으면 목록 없이, 아니면 큰 집합에 작은 집합을 합침
+        uniqueOverflow = uniqueOverflow || other.uniqueOverflow;
+        if (uniqueOverflow) {
+            numericValues = QSet<double>();
+            textValues = QSet<QString>();
+        } else {
+            if (numericValues.size() < other.numericValues.size()) {
+                numericValues.swap(other.numericValues);
+            }
+            numericValues.unite(other.numericValues);
+            if (textValues.size() < other.textValues.size()) {
+                textValues.swap(other.textValues);
+            }
+            textValues.unite(other.textValues);
+            checkUniqueLimit();
+        }
+        
+        distinct.merge(other.distinct);
+        if (trackTop) {
+            topValues.merge(other.topValues);
+        }
+    }
+    
+    HGISFieldStatistics finish(const QString &fieldName) const
+    {
+        HGISFieldStatistics stats;
+        stats.fieldName = fieldName;
+        stats.count = count;
+        stats.nullCount = nullCount;
+        stats.numericCount = numericCount;
+        
+        if (numericCount > 0) {
+            stats.minimum = minimum;
+            stats.maximum = maximum;
+            stats.sum = sum;
+            stats.mean = mean;
+            stats.stddev = std::sqrt(m2 / numericCount);
+        }
+        
+        if (keepUnique && !uniqueOverflow) {
+            // 고유값: 숫자 먼저 (오름차순), 이어서 문자열 (사전순)
+            QList<double> numbers = numericValues.values();
+            std::sort(numbers.begin(), numbers.end());
+            QStringList texts = textValues.values();
+            std::sort(texts.begin(), texts.end());
+            
+            stats.distinctCount = numbers.size() + texts.size();
+            stats.uniqueValues.reserve(stats.distinctCount);
+            for (double value : numbers) {
+                stats.uniqueValues.append(value);
+            }
+            for (const QString &value : texts) {
+                stats.uniqueValues.append(value);
+            }
+        } else {
+            stats.distinctCount = std::llround(distinct.estimate());
+            stats.distinctExact = false;
+        }
+        
+        stats.distinctSketch = distinct;
+        stats.topValuesSketch = topValues;
+        return stats;
+    }
+};
+
+// 히스토그램 구간에 값 하나를 셈 (최댓값은 마지막 구간에 포함)
+// 값을 모아 두지 않도록 최솟값/최댓값을 안 뒤 두 번째 순회에서 채움
+void addToHistogram(QVector<long> &histogram, double value, double minimum, double maximum)
+{
+    if (histogram.isEmpty() || std::isnan(value)) {
+        return;
+    }
+    const int bins = histogram.size();
+    const double width = maximum - minimum;
+    const int bin = width > 0 ? static_cast<int>((value - minimum) / width * bins) : 0;
+    histogram[std::max(0, std::min(bin, bins - 1))]++;
+}
+
+// 히스토그램을 채울 필드만 구간을 만들어 둠 (나머지는 빈 벡터)
+QVector<QVector<long>> createHistograms(const QVector<HGISFieldStatistics> &stats, int bins)
+{
+    QVector<QVector<long>> histograms(stats.size());
+    for (int i = 0; i < stats.size(); ++i) {
+        if (bins > 0 && stats[i].numericCount > 0) {
+            histograms[i].fill(0, bins);
+        }
+    }
+    return histograms;
+}
+
+bool needsHistogram(const QVector<QVector<long>> &histograms)
+{
+    return std::any_of(histograms.begin(), histograms.end(),
+                       [](const QVector<long> &histogram) { return !histogram.isEmpty(); });
+}
+
+using Accumulators = std::vector<Accumulator>;
+
+Accumulators createAccumulators(int fieldCount, const HGISStatisticsEngine::Options &options)
+{
+    Accumulators accumulators(fieldCount);
+    for (Accumulator &accumulator : accumulators) {
+        accumulator.keepUnique = options.collectUniqueValues;
+        accumulator.maxUnique = options.maxUniqueValues;
+        accumulator.trackTop = options.topK > 0;
+        accumulator.distinct = HGISHyperLogLog(options.sketchPrecision);
+        if (accumulator.trackTop) {
+            accumulator.topValues = HGISSpaceSaving(options.topK);
+        }
+    }
+    return accumulators;
+}
+
+void mergeAccumulators(Accumulators &target, Accumulators &source)
+{
+    for (std::size_t i = 0; i < target.size(); ++i) {
+        target[i].merge(source[i]);
+    }
+}
+
+QVector<HGISFieldStatistics> finishAccumulators(const Accumulators &accumulators,
+                                                const QStringList &fieldNames)
+{
+    QVector<HGISFieldStatistics> result;
+    result.reserve(fieldNames.size());
+    for (int i = 0; i < fieldNames.size(); ++i) {
+        result.append(accumulators[i].finish(fieldNames[i]));
+    }
+    return result;
+}
+
+int resolveThreadCount(const HGISStatisticsEngine::Options &options)
+{
+    return options.threadCount > 0 ? options.threadCount : qMax(1, QThread::idealThreadCount());
+}
+
+// 제공자의 SQL 엔진에 집계를 위임 (지원하지 않거나 실패하면 false)
+bool calculateWithSql(const HGISGdalProvider &provider,
+                      const QStringList &fieldNames,
+                      const HGISStatisticsEngine::Options &options,
+                      QVector<HGISFieldStatistics> &result)
+{
+    if (!provider.supportsAggregatePushdown()) {
+        return false;
+    }
+    
+    // 표본 크기는 다른 경로와 같이 앞쪽 maxFeatures개 피처
+    const long sample = options.maxFeatures;
+    std::vector<HGISGdalProvider::FieldAggregate> aggregates;
+    if (!provider.aggregateFields(fieldNames, aggregates, sample)) {
+        return false;
+    }
+    
+    result.clear();
+    result.reserve(fieldNames.size());
+    for (const HGISGdalProvider::FieldAggregate &aggregate : aggregates) {
+        HGISFieldStatistics stats;
+        stats.fieldName = aggregate.fieldName;
+        stats.count = aggregate.count;
+        stats.nullCount = aggregate.nullCount;
+        stats.numericCount = aggregate.numeric ? aggregate.count : 0;
+        stats.distinctCount = aggregate.distinctCount;
+        
+        if (stats.numericCount > 0) {
+            stats.minimum = aggregate.minimum;
+            stats.maximum = aggregate.maximum;
+            stats.sum = aggregate.sum;
+            stats.mean = aggregate.mean;
+            stats.stddev = aggregate.stddev;
+        }
+        
+        // COUNT(DISTINCT)가 정확하므로 고유값 목록은 요청할 때만 (표본 안에서, 상한 이하일 때) 가져옴
+        const bool withinLimit = options.maxUniqueValues <= 0 || stats.distinctCount <= options.maxUniqueValues;
+        if (options.collectUniqueValues && withinLimit && stats.count > 0) {
+            if (!provider.distinctValues(aggregate.fieldName, stats.uniqueValues, sample)) {
+                return false;
+            }
+            stats.distinctSketch = HGISHyperLogLog(options.sketchPrecision);
+            for (const QVariant &value : stats.uniqueValues) {
+                stats.distinctSketch.add(value);
+            }
+        }
+        
+        if (options.topK > 0 && stats.count > 0) {
+            QVariantList values;
+            QVector<long> counts;
+            if (!provider.mostFrequentValues(aggregate.fieldName, options.topK, values, counts, sample)) {
+                return false;
+            }
+            stats.topValuesSketch = HGISSpaceSaving(options.topK);
+            for (int i = 0; i < values.size(); ++i) {
+                stats.topValuesSketch.add(values[i], counts[i]);
+            }
+        }
+        
+        if (options.histogramBins > 0 && stats.numericCount > 0
+            && !provider.histogram(aggregate.fieldName, stats.minimum, stats.maximum,
+                                   options.histogramBins, stats.histogram, sample)) {
+            return false;
+        }
+        
+        result.append(stats);
+    }
+    return true;
+}
+}
+
+QVector<HGISFieldStatistics> HGISStatisticsEngine::calculate(const std::vector<HGISGdalProvider::Feature> &features,
+                                                             const QStringList &fieldNames,
+                                                             const Options &options)
+{
+    QElapsedTimer timer;
+    timer.start();
+    
+    const std::size_t total = options.maxFeatures > 0
+        ? std::min<std::size_t>(features.size(), static_cast<std::size_t>(options.maxFeatures))
+        : features.size();
+    const std::size_t chunkCount = std::max<std::size_t>(1,
+        std::min<std::size_t>(resolveThreadCount(options), total / kMinChunkSize));
+    const std::size_t chunkSize = (total + chunkCount - 1) / chunkCount;
+    
+    // 구간별 부분 집계
+    auto accumulate = [&](std::size_t begin, std::size_t end) {
+        Accumulators accumulators = createAccumulators(fieldNames.size(), options);
+        for (std::size_t i = begin; i < end; ++i) {
+            const QVariantMap &attributes = features[i].attributes;
+            for (int f = 0; f < fieldNames.size(); ++f) {
+                auto it = attributes.constFind(fieldNames[f]);
+                if (it == attributes.constEnd()) {
+                    accumulators[f].addNull();
+                } else {
+                    accumulators[f].addVariant(it.value());
+                }
+            }
+        }
+        return accumulators;
+    };
+    
+    // 나머지 구간은 전역 작업 스레드 풀에서 (구간마다 스레드를 만들지 않음)
+    std::vector<std::future<Accumulators>> parts;
+    for (std::size_t c = 1; c < chunkCount; ++c) {
+        const std::size_t begin = c * chunkSize;
+        const std::size_t end = std::min(total, begin + chunkSize);
+        parts.push_back(HGISWorkerPool::globalInstance().submit([&accumulate, begin, end](int) {
+            return accumulate(begin, end);
+        }));
+    }
+    
+    // 첫 구간은 호출 스레드에서 처리
+    Accumulators result = accumulate(0, std::min(total, chunkSize));
+    for (std::future<Accumulators> &part : parts) {
+        Accumulators partial = part.get();
+        mergeAccumulators(result, partial);
+    }
+    
+    QVector<HGISFieldStatistics> stats = finishAccumulators(result, fieldNames);
+    
+    // 히스토그램은 최솟값/최댓값을 안 뒤 같은 구간 나눔으로 한 번 더 순회
+    QVector<QVector<long>> histograms = createHistograms(stats, options.histogramBins);
+    if (needsHistogram(histograms)) {
+        auto countBins = [&](std::size_t begin, std::size_t end) {
+            QVector<QVector<long>> partial = histograms;
+            for (std::size_t i = begin; i < end; ++i) {
+                const QVariantMap &attributes = features[i].attributes;
+                for (int f = 0; f < fieldNames.size(); ++f) {
+                    if (partial[f].isEmpty()) {
+                        continue;
+                    }
+                    auto it = attributes.constFind(fieldNames[f]);
+                    if (it != attributes.constEnd() && !it.value().isNull() && Accumulator::isNumber(it.value())) {
+                        addToHistogram(partial[f], it.value().toDouble(), stats[f].minimum, stats[f].maximum);
+                    }
+                }
+            }
+            return partial;
+        };
+        
+        std::vector<std::future<QVector<QVector<long>>>> binParts;
+        for (std::size_t c = 1; c < chunkCount; ++c) {
+            const std::size_t begin = c * chunkSize;
+            const std::size_t end = std::min(total, begin + chunkSize);
+            binParts.push_back(HGISWorkerPool::globalInstance().submit([&countBins, begin, end](int) {
+                return countBins(begin, end);
+            }));
+        }
+        
+        histograms = countBins(0, std::min(total, chunkSize));
+        for (std::future<QVector<QVector<long>>> &part : binParts) {
+            const QVector<QVector<long>> partial = part.get();
+            for (int f = 0; f < histograms.size(); ++f) {
+                for (int bin = 0; bin < histograms[f].size(); ++bin) {
+                    histograms[f][bin] += partial[f][bin];
+                }
+            }
+        }
+        for (int f = 0; f < stats.size(); ++f) {
+            stats[f].histogram = histograms[f];
+        }
+    }
+    
+    qDebug() << "필드 통계 계산:" << fieldNames << "피처 수:" << total
+             << "스레드:" << chunkCount << timer.elapsed() << "ms";
+    
+    return stats;
+}
+
+QVector<HGISFieldStatistics> HGISStatisticsEngine::calculate(const HGISGdalProvider &provider,
+                                                             const QStringList &fieldNames,
+                                                             const Options &options)
+{
+    QElapsedTimer timer;
+    timer.start();
+    
+    QVector<HGISFieldStatistics> sqlResult;
+    if (calculateWithSql(provider, fieldNames, options, sqlResult)) {
+        qDebug() << "필드 통계 계산 (SQL 위임):" << fieldNames << timer.elapsed() << "ms";
+        return sqlResult;
+    }
+    
+    Accumulators result = createAccumulators(fieldNames.size(), options);
+    
+    OGRLayerH layer = provider.layerHandle();
+    if (!layer) {
+        return finishAccumulators(result, fieldNames);
+    }
+    
+    // 필드 인덱스와 숫자 여부 (없는 필드는 -1 -> 모두 NULL)
+    OGRFeatureDefnH defn = OGR_L_GetLayerDefn(layer);
+    std::vector<int> fieldIndices;
+    std::vector<bool> numericFields;
+    for (const QString &name : fieldNames) {
+        const int index = OGR_FD_GetFieldIndex(defn, name.toUtf8().constData());
+        fieldIndices.push_back(index);
+        
+        bool numeric = false;
+        if (index >= 0) {
+            const OGRFieldType type = OGR_Fld_GetType(OGR_FD_GetFieldDefn(defn, index));
+            numeric = (type == OFTInteger || type == OFTInteger64 || type == OFTReal);
+        }
+        numericFields.push_back(numeric);
+    }
+    
+    // 작업 스레드에서 묶음 하나를 집계하고 피처 해제
+    auto accumulate = [&](std::vector<OGRFeatureH> batch) {
+        Accumulators accumulators = createAccumulators(fieldNames.size(), options);
+        for (OGRFeatureH feature : batch) {
+            for (std::size_t f = 0; f < fieldIndices.size(); ++f) {
+                const int index = fieldIndices[f];
+                if (index < 0 || !OGR_F_IsFieldSetAndNotNull(feature, index)) {
+                    accumulators[f].addNull();
+                } else if (numericFields[f]) {
+                    accumulators[f].addNumber(OGR_F_GetFieldAsDouble(feature, index));
+                } else {
+                    accumulators[f].addText(QString::fromUtf8(OGR_F_GetFieldAsString(feature, index)));
+                }
+            }
+            OGR_F_Destroy(feature);
+        }
+        return accumulators;
+    };
+    
+    // 읽기는 호출 스레드, 집계는 전역 작업 스레드 풀이 묶음을 차례로 처리
+    // (호출마다 스레드를 만들지 않음, 처리 중인 묶음은 threadCount개까지만 두어 메모리 제한)
+    const int threadCount = resolveThreadCount(options);
+    HGISWorkerPool &workers = HGISWorkerPool::globalInstance();
+    std::deque<std::future<Accumulators>> inFlight;
+    
+    auto collect = [&]() {
+        Accumulators partial = inFlight.front().get();
+        inFlight.pop_front();
+        mergeAccumulators(result, partial);
+    };
+    
+    long accepted = 0;
+    long total = provider.readFeatureBatches(static_cast<std::size_t>(qMax(1, options.batchSize)),
+                                             [&](std::vector<OGRFeatureH> &batch) {
+        // 표본 크기를 넘는 피처는 버림
+        if (options.maxFeatures > 0 && accepted + static_cast<long>(batch.size()) > options.maxFeatures) {
+            const std::size_t keep = static_cast<std::size_t>(options.maxFeatures - accepted);
+            for (std::size_t i = keep; i < batch.size(); ++i) {
+                OGR_F_Destroy(batch[i]);
+            }
+            batch.resize(keep);
+        }
+        accepted += static_cast<long>(batch.size());
+        
+        if (static_cast<int>(inFlight.size()) >= threadCount) {
+            collect();
+        }
+        inFlight.push_back(workers.submit([&accumulate, batch = std::move(batch)](int) mutable {
+            return accumulate(std::move(batch));
+        }));
+        batch.clear();
+        return options.maxFeatures <= 0 || accepted < options.maxFeatures;
+    });
+    
+    while (!inFlight.empty()) {
+        collect();
+    }
+    
+    QVector<HGISFieldStatistics> stats = finishAccumulators(result, fieldNames);
+    
+    // 히스토그램은 최솟값/최댓값을 안 뒤 같은 표본을 한 번 더 스트리밍하며 채움 (값을 모아 두지 않음)
+    QVector<QVector<long>> histograms = createHistograms(stats, options.histogramBins);
+    if (needsHistogram(histograms)) {
+        long binned = 0;
+        provider.readFeatureBatches(static_cast<std::size_t>(qMax(1, options.batchSize)),
+                                    [&](std::vector<OGRFeatureH> &batch) {
+            for (OGRFeatureH feature : batch) {
+                if (options.maxFeatures <= 0 || binned < options.maxFeatures) {
+                    for (int f = 0; f < histograms.size(); ++f) {
+                        const int index = fieldIndices[static_cast<std::size_t>(f)];
+                        if (!histograms[f].isEmpty() && OGR_F_IsFieldSetAndNotNull(feature, index)) {
+                            addToHistogram(histograms[f], OGR_F_GetFieldAsDouble(feature, index),
+                                           stats[f].minimum, stats[f].maximum);
+                        }
+                    }
+                    ++binned;
+                }
+                OGR_F_Destroy(feature);
+            }
+            batch.clear();
+            return options.maxFeatures <= 0 || binned < options.maxFeatures;
+        });
+        for (int f = 0; f < stats.size(); ++f) {
+            stats[f].histogram = histograms[f];
+        }
+    }
+    
+    qDebug() << "필드 통계 계산 (스트리밍):" << fieldNames << "피처 수:" << qMin(total, accepted)
+             << "스레드:" << threadCount << timer.elapsed() << "ms";
+    
+    return stats;
+}
@@ -0,0 +1,98 @@
+#ifndef HGISSTATISTICSENGINE_H
+#define HGISSTATISTICSENGINE_H
+
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <QVector>
+#include <limits>
+#include <vector>
+#include "HGISFieldSketch.h"
+#include "providers/HGISGdalProvider.h"
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+// 필드 하나의 통계
+struct HGISFieldStatistics
+{
+    QString fieldName;
+    long count = 0;             // 값이 있는 피처 수
+    long nullCount = 0;         // 값이 없는 (NULL) 피처 수
+    long numericCount = 0;      // 숫자 값 수 (나머지는 문자열로 취급)
+    
+    // 숫자 값 통계 (숫자 값이 없으면 NaN)
+    double minimum = std::numeric_limits<double>::quiet_NaN();
+    double maximum = std::numeric_limits<double>::quiet_NaN();
+    double sum = 0.0;
+    double mean = std::numeric_limits<double>::quiet_NaN();
+    double stddev = std::numeric_limits<double>::quiet_NaN();  // 모표준편차
+    
+    // 고유값 (숫자는 오름차순, 문자열은 사전순)
+    // collectUniqueValues 옵션이 꺼져 있거나 고유값이 maxUniqueValues를 넘으면
+    // uniqueValues는 비고 distinctCount는 추정값
+    long distinctCount = 0;
+    bool distinctExact = true;
+    QVariantList uniqueValues;
+    
+    // 근사 요약 - 고유값이 많아도 메모리가 일정하고, 스레드/레이어 사이에서 병합 가능
+    HGISHyperLogLog distinctSketch;     // 고유값 수 추정
+    HGISSpaceSaving topValuesSketch;    // 빈도 상위 값
+    
+    // [minimum, maximum] 구간을 균등 분할한 도수 (최댓값은 마지막 구간에 포함)
+    QVector<long> histogram;
+    
+    bool isNumeric() const { return numericCount > 0 && numericCount == count; }
+    
+    // 고유값 수 (정확한 값이 없으면 HyperLogLog 추정)
+    double approximateDistinctCount() const
+    {
+        return distinctExact || distinctSketch.isEmpty() ? double(distinctCount) : distinctSketch.estimate();
+    }
+    
+    // 빈도 상위 n개 값
+    QVector<HGISValueCount> topValues(int n = 10) const { return topValuesSketch.top(n); }
+    
+    // 분류 심볼로 표현할 만한 필드인지 (고유값 수가 maxCategories 이하)
+    bool isCategorizable(int maxCategories = 64) const
+    {
+        return count > 0 && approximateDistinctCount() <= maxCategories;
+    }
+};
+
+// 통계 계산 옵션
+struct HGISStatisticsOptions
+{
+    int histogramBins = 32;     // 0이면 히스토그램 생략
+    int threadCount = 0;        // 동시에 처리할 구간/묶음 수 (전역 작업 스레드 풀에서 실행), 0이면 CPU 코어 수
+    int batchSize = 8192;       // 제공자 스트리밍 시 작업 스레드 하나가 처리하는 피처 수
+    bool collectUniqueValues = false;   // true면 고유값 목록도 수집 (기본은 HyperLogLog 추정만)
+    int maxUniqueValues = 4096; // 고유값 목록 상한 - 넘으면 목록을 버리고 추정만 (0이면 제한 없음)
+    int topK = 64;              // 빈도 상위 값 카운터 수 (0이면 생략)
+    int sketchPrecision = 14;   // HyperLogLog 정밀도
+    long maxFeatures = 0;       // 0보다 크면 앞쪽 피처만 표본으로 계산
+};
+
+// 여러 필드의 통계를 한 번의 병렬 순회로 계산
+// 피처를 구간으로 나눠 스레드별 부분 집계(Welford 평균/분산, 최솟값/최댓값, 근사 요약)를 만든 뒤 병합
+// 히스토그램은 최솟값/최댓값이 정해진 뒤 두 번째 순회에서 고정 구간으로 채움 (값을 모아 두지 않음)
+class CORE_EXPORT HGISStatisticsEngine
+{
+public:
+    using Options = HGISStatisticsOptions;
+    
+    // 메모리에 읽어 둔 피처에서 계산
+    static QVector<HGISFieldStatistics> calculate(const std::vector<HGISGdalProvider::Feature> &features,
+                                                  const QStringList &fieldNames,
+                                                  const Options &options = Options());
+    
+    // 제공자에서 피처를 묶음 단위로 스트리밍하며 계산 (전체 피처를 메모리에 올리지 않음)
+    static QVector<HGISFieldStatistics> calculate(const HGISGdalProvider &provider,
+                                                  const QStringList &fieldNames,
+                                                  const Options &options = Options());
+};
+
+#endif // HGISSTATISTICSENGINE_H
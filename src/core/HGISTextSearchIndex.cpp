@@ -0,0 +1,476 @@
+#include "HGISTextSearchIndex.h"
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QSet>
+#include <QThread>
+#include <ogr_api.h>
+#include <algorithm>
+#include <iterator>
+
+namespace
+{
+constexpr std::size_t kBuildBatchSize = 8192;
+
+// 한글 음절 (가 ~ 힣) 과 초성 호환 자모 (ㄱ ~ ㅎ)
+constexpr ushort kSyllableFirst = 0xAC00;
+constexpr ushort kSyllableLast = 0xD7A3;
+constexpr ushort kJamoFirst = 0x3131;
+constexpr ushort kJamoLast = 0x314E;
+constexpr int kSyllablesPerInitial = 21 * 28;     // 중성 21 x 종성 28
+
+const ushort kInitialJamo[19] = {
+    0x3131, 0x3132, 0x3134, 0x3137, 0x3138, 0x3139, 0x3141, 0x3142, 0x3143, 0x3145,
+    0x3146, 0x3147, 0x3148, 0x3149, 0x314A, 0x314B, 0x314C, 0x314D, 0x314E
+};
+
+inline bool isJamo(QChar c)
+{
+    return c.unicode() >= kJamoFirst && c.unicode() <= kJamoLast;
+}
+
+// 검색용 정규화: NFC (분리된 자모 조합), 대소문자 무시, 연속 공백은 하나로
+QString normalized(const QString &text)
+{
+    return text.normalized(QString::NormalizationForm_C).toCaseFolded().simplified();
+}
+
+// n-gram 키: 한 글자는 그대로, 두 글자는 상위 16비트에 첫 글자
+inline quint32 unigramKey(QChar c)
+{
+    return c.unicode();
+}
+
+inline quint32 bigramKey(QChar a, QChar b)
+{
+    return (static_cast<quint32>(a.unicode()) << 16) | b.unicode();
+}
+
+QVector<int> intersectSorted(const QVector<int> &a, const QVector<int> &b)
+{
+    QVector<int> result;
+    result.reserve(qMin(a.size(), b.size()));
+    std::set_intersection(a.cbegin(), a.cend(), b.cbegin(), b.cend(), std::back_inserter(result));
+    return result;
+}
+
+// 필드 값을 정규화해 문서 하나로 (필드 사이는 줄바꿈 - 검색어에는 들어갈 수 없어 필드를 넘는 일치가 없음)
+QString documentText(const QVariantMap &attributes, const QStringList &fieldNames)
+{
+    QStringList parts;
+    for (const QString &fieldName : fieldNames) {
+        const QVariant value = attributes.value(fieldName);
+        if (!value.isNull()) {
+            const QString text = normalized(value.toString());
+            if (!text.isEmpty()) {
+                parts.append(text);
+            }
+        }
+    }
+    return parts.join('\n');
+}
+}
+
+// 문서 목록 + 역색인 (생성이 끝나면 통째로 교체, 이후 갱신은 색인이 속한 스레드에서만)
+struct HGISTextSearchData {
+    QStringList fieldNames;
+    std::vector<long> featureIds;                // 문서 -> 피처 ID
+    QVector<QString> texts;                      // 정규화된 문서
+    QVector<QString> initialTexts;               // 초성 문서 (texts와 글자 위치가 같음)
+    std::vector<char> removed;                   // 갱신/삭제로 무효가 된 문서
+    int removedCount = 0;
+    QHash<long, int> documentOfFeature;
+    QHash<quint32, QVector<int>> grams;          // n-gram -> 오름차순 문서 목록
+    
+    int liveCount() const
+    {
+        return texts.size() - removedCount;
+    }
+    
+    void addGram(quint32 key, int document)
+    {
+        // 같은 문서가 같은 목록에 두 번 들어가지 않도록 마지막 값만 확인
+        QVector<int> &list = grams[key];
+        if (list.isEmpty() || list.last() != document) {
+            list.append(document);
+        }
+    }
+    
+    void indexDocument(int document)
+    {
+        const QString &text = texts[document];
+        const QString &initial = initialTexts[document];
+        
+        for (int k = 0; k < text.size(); ++k) {
+            addGram(unigramKey(text[k]), document);
+            if (k + 1 < text.size()) {
+                addGram(bigramKey(text[k], text[k + 1]), document);
+            }
+            
+            // 초성이 들어간 n-gram만 추가 (나머지는 원문 n-gram과 같음)
+            if (isJamo(initial[k])) {
+                addGram(unigramKey(initial[k]), document);
+            }
+            if (k + 1 < text.size() && (isJamo(initial[k]) || isJamo(initial[k + 1]))) {
+                addGram(bigramKey(initial[k], initial[k + 1]), document);
+            }
+        }
+    }
+    
+    void append(long featureId, const QString &text)
+    {
+        remove(featureId);
+        if (text.isEmpty()) {
+            return;
+        }
+        
+        const int document = texts.size();
+        featureIds.push_back(featureId);
+        texts.append(text);
+        initialTexts.append(HGISTextSearchIndex::initials(text));
+        removed.push_back(0);
+        documentOfFeature.insert(featureId, document);
+        indexDocument(document);
+    }
+    
+    void remove(long featureId)
+    {
+        auto it = documentOfFeature.find(featureId);
+        if (it == documentOfFeature.end()) {
+            return;
+        }
+        removed[it.value()] = 1;
+        ++removedCount;
+        documentOfFeature.erase(it);
+    }
+    
+    // 무효 문서가 많아지면 살아 있는 문서만으로 다시 색인
+    void compactIfNeeded()
+    {
+        if (removedCount < qMax(1024, texts.size() / 4)) {
+            return;
+        }
+        
+        HGISTextSearchData compacted;
+        compacted.fieldNames = fieldNames;
+        for (int document = 0; document < texts.size(); ++document) {
+            if (!removed[document]) {
+                compacted.append(featureIds[document], texts[document]);
+            }
+        }
+        *this = std::move(compacted);
+    }
+    
+    // 문서의 어느 위치에서든 단어와 일치하는지 (초성 글자는 초성 문서와 비교)
+    bool matches(int document, const QString &word, bool hasJamo) const
+    {
+        const QString &text = texts[document];
+        if (!hasJamo) {
+            return text.contains(word);
+        }
+        
+        const QString &initial = initialTexts[document];
+        for (int position = 0; position + word.size() <= text.size(); ++position) {
+            int k = 0;
+            for (; k < word.size(); ++k) {
+                const QChar c = word[k];
+                if (isJamo(c) ? initial[position + k] != c : text[position + k] != c) {
+                    break;
+                }
+            }
+            if (k == word.size()) {
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    // 단어를 포함하는 문서 (n-gram 후보 교집합 후 실제 일치 확인)
+    QVector<int> match(const QString &word) const
+    {
+        const bool hasJamo = std::any_of(word.cbegin(), word.cend(), isJamo);
+        const QString key = hasJamo ? HGISTextSearchIndex::initials(word) : word;
+        
+        QVector<int> candidates;
+        if (key.size() == 1) {
+            candidates = grams.value(unigramKey(key[0]));
+        } else {
+            QVector<const QVector<int>*> lists;
+            for (int k = 0; k + 1 < key.size(); ++k) {
+                auto it = grams.constFind(bigramKey(key[k], key[k + 1]));
+                if (it == grams.constEnd()) {
+                    return QVector<int>();
+                }
+                lists.append(&it.value());
+            }
+            
+            // 짧은 목록부터 교집합
+            std::sort(lists.begin(), lists.end(),
+                      [](const QVector<int> *a, const QVector<int> *b) { return a->size() < b->size(); });
+            candidates = *lists.first();
+            for (int k = 1; k < lists.size() && !candidates.isEmpty(); ++k) {
+                candidates = intersectSorted(candidates, *lists[k]);
+            }
+        }
+        
+        // 두 글자 이하 원문 검색은 n-gram 일치가 곧 포함
+        const bool verify = hasJamo || word.size() > 2;
+        QVector<int> verified;
+        verified.reserve(candidates.size());
+        for (int document : candidates) {
+            if (!removed[document] && (!verify || matches(document, word, hasJamo))) {
+                verified.append(document);
+            }
+        }
+        return verified;
+    }
+};
+
+class HGISTextSearchIndex::Private
+{
+public:
+    struct PendingChange {
+        long featureId;
+        bool remove;
+        QVariantMap attributes;
+    };
+    
+    std::shared_ptr<HGISTextSearchData> data;    // 생성 전에는 nullptr
+    int generation = 0;
+    bool building = false;
+    QVector<PendingChange> pending;              // 생성 중에 들어온 갱신
+    
+    void apply(const PendingChange &change)
+    {
+        if (change.remove) {
+            data->remove(change.featureId);
+        } else {
+            data->append(change.featureId, documentText(change.attributes, data->fieldNames));
+        }
+        data->compactIfNeeded();
+    }
+    
+    // 데이터 소스를 따로 열어 문자열 필드만 읽음 (작업 스레드에서 호출)
+    static std::shared_ptr<HGISTextSearchData> buildFromDataset(const QString &datasetPath,
+                                                                const QStringList &fieldNames)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        
+        auto data = std::make_shared<HGISTextSearchData>();
+        
+        // OGR 레이어 핸들은 스레드 간에 공유할 수 없으므로 별도로 엶
+        HGISGdalProvider provider(datasetPath);
+        if (!provider.open()) {
+            qWarning() << "검색 색인 생성 실패 - 데이터 소스를 열 수 없습니다:" << datasetPath;
+            return data;
+        }
+        
+        OGRFeatureDefnH defn = OGR_L_GetLayerDefn(provider.layerHandle());
+        std::vector<int> fieldIndices;
+        if (fieldNames.isEmpty()) {
+            for (int i = 0; i < OGR_FD_GetFieldCount(defn); ++i) {
+                OGRFieldDefnH field = OGR_FD_GetFieldDefn(defn, i);
+                if (OGR_Fld_GetType(field) == OFTString) {
+                    data->fieldNames.append(QString::fromUtf8(OGR_Fld_GetNameRef(field)));
+                    fieldIndices.push_back(i);
+                }
+            }
+        } else {
+            for (const QString &fieldName : fieldNames) {
+                const int index = OGR_FD_GetFieldIndex(defn, fieldName.toUtf8().constData());
+                if (index >= 0) {
+                    data->fieldNames.append(fieldName);
+                    fieldIndices.push_back(index);
+                }
+            }
+        }
+        
+        if (fieldIndices.empty()) {
+            return data;
+        }
+        
+        provider.readFeatureBatches(kBuildBatchSize, [&](std::vector<OGRFeatureH> &batch) {
+            QStringList parts;
+            for (OGRFeatureH feature : batch) {
+                parts.clear();
+                for (int index : fieldIndices) {
+                    if (OGR_F_IsFieldSetAndNotNull(feature, index)) {
+                        const QString text = normalized(QString::fromUtf8(OGR_F_GetFieldAsString(feature, index)));
+                        if (!text.isEmpty()) {
+                            parts.append(text);
+                        }
+                    }
+                }
+                data->append(static_cast<long>(OGR_F_GetFID(feature)), parts.join('\n'));
+                OGR_F_Destroy(feature);
+            }
+            return true;
+        });
+        
+        qInfo() << "검색 색인 생성 완료:" << data->fieldNames
+                << "문서 수:" << data->liveCount()
+                << "n-gram 수:" << data->grams.size()
+                << timer.elapsed() << "ms";
+        
+        return data;
+    }
+};
+
+HGISTextSearchIndex::HGISTextSearchIndex(QObject *parent)
+    : QObject(parent)
+    , d(std::make_unique<Private>())
+{
+}
+
+HGISTextSearchIndex::~HGISTextSearchIndex() = default;
+
+void HGISTextSearchIndex::buildInBackground(const QString &datasetPath, const QStringList &fieldNames)
+{
+    const int generation = ++d->generation;
+    d->building = true;
+    
+    // 결과는 작업 스레드가 끝난 뒤 색인이 속한 스레드에서 교체
+    // (finished 연결은 색인이 먼저 삭제되면 자동으로 끊김)
+    auto result = std::make_shared<std::shared_ptr<HGISTextSearchData>>();
+    QThread *thread = QThread::create([result, datasetPath, fieldNames]() {
+        *result = Private::buildFromDataset(datasetPath, fieldNames);
+    });
+    
+    connect(thread, &QThread::finished, this, [this, result, generation]() {
+        if (generation != d->generation) {
+            return;     // 더 새로운 생성 요청이 있음
+        }
+        
+        d->data = *result;
+        d->building = false;
+        for (const Private::PendingChange &change : d->pending) {
+            d->apply(change);
+        }
+        d->pending.clear();
+        emit ready();
+    });
+    connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+    thread->start(QThread::LowPriority);
+}
+
+void HGISTextSearchIndex::build(const std::vector<HGISGdalProvider::Feature> &features,
+                                const QStringList &fieldNames)
+{
+    ++d->generation;
+    d->building = false;
+    d->pending.clear();
+    
+    auto data = std::make_shared<HGISTextSearchData>();
+    data->fieldNames = fieldNames;
+    
+    // 필드를 지정하지 않으면 문자열 값이 있는 필드 전체
+    if (data->fieldNames.isEmpty()) {
+        QSet<QString> stringFields;
+        for (const HGISGdalProvider::Feature &feature : features) {
+            for (auto it = feature.attributes.constBegin(); it != feature.attributes.constEnd(); ++it) {
+                if (it.value().type() == QVariant::String) {
+                    stringFields.insert(it.key());
+                }
+            }
+        }
+        data->fieldNames = stringFields.values();
+        data->fieldNames.sort();
+    }
+    
+    for (const HGISGdalProvider::Feature &feature : features) {
+        data->append(feature.id, documentText(feature.attributes, data->fieldNames));
+    }
+    
+    d->data = data;
+    emit ready();
+}
+
+bool HGISTextSearchIndex::isReady() const
+{
+    return d->data != nullptr;
+}
+
+bool HGISTextSearchIndex::isBuilding() const
+{
+    return d->building;
+}
+
+QStringList HGISTextSearchIndex::fieldNames() const
+{
+    return d->data ? d->data->fieldNames : QStringList();
+}
+
+int HGISTextSearchIndex::documentCount() const
+{
+    return d->data ? d->data->liveCount() : 0;
+}
+
+void HGISTextSearchIndex::updateFeature(long featureId, const QVariantMap &attributes)
+{
+    Private::PendingChange change{featureId, false, attributes};
+    if (d->building) {
+        d->pending.append(change);
+    } else if (d->data) {
+        d->apply(change);
+    }
+}
+
+void HGISTextSearchIndex::removeFeature(long featureId)
+{
+    Private::PendingChange change{featureId, true, QVariantMap()};
+    if (d->building) {
+        d->pending.append(change);
+    } else if (d->data) {
+        d->apply(change);
+    }
+}
+
+QVector<long> HGISTextSearchIndex::search(const QString &query, int limit) const
+{
+    if (!d->data) {
+        return QVector<long>();
+    }
+    
+    const HGISTextSearchData &data = *d->data;
+    const QStringList words = normalized(query).split(' ', QString::SkipEmptyParts);
+    if (words.isEmpty()) {
+        return QVector<long>();
+    }
+    
+    QVector<int> documents;
+    bool first = true;
+    for (const QString &word : words) {
+        QVector<int> matches = data.match(word);
+        documents = first ? matches : intersectSorted(documents, matches);
+        first = false;
+        if (documents.isEmpty()) {
+            break;
+        }
+    }
+    
+    // 갱신된 문서는 뒤에 붙으므로 피처 ID 순으로 다시 정렬
+    QVector<long> result;
+    result.reserve(documents.size());
+    for (int document : documents) {
+        result.append(data.featureIds[document]);
+    }
+    std::sort(result.begin(), result.end());
+    
+    if (limit > 0 && result.size() > limit) {
+        result.resize(limit);
+    }
+    return result;
+}
+
+QString HGISTextSearchIndex::initials(const QString &text)
+{
+    QString result = text;
+    for (QChar &c : result) {
+        const ushort code = c.unicode();
+        if (code >= kSyllableFirst && code <= kSyllableLast) {
+            c = QChar(kInitialJamo[(code - kSyllableFirst) / kSyllablesPerInitial]);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,62 @@
+#ifndef HGISTEXTSEARCHINDEX_H
+#define HGISTEXTSEARCHINDEX_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <QVector>
+#include <memory>
+#include <vector>
+#include "providers/HGISGdalProvider.h"
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+// 문자열 속성 전체 텍스트 검색 색인
+// 선택한 필드를 피처 하나의 문서로 묶어 글자 단위 bigram 역색인을 만들고,
+// 한글 음절은 초성(ㄱ~ㅎ)으로 바꾼 열도 함께 색인해 "ㄱㅂ" 같은 초성 검색을 지원
+// 생성은 데이터 소스를 따로 열어 백그라운드 스레드에서 하고, 이후 피처 단위로 갱신 가능
+class CORE_EXPORT HGISTextSearchIndex : public QObject
+{
+    Q_OBJECT
+    
+public:
+    explicit HGISTextSearchIndex(QObject *parent = nullptr);
+    ~HGISTextSearchIndex();
+    
+    // 백그라운드 생성 (fieldNames가 비어 있으면 모든 문자열 필드)
+    // 생성 중에 다시 호출하면 이전 결과는 버림
+    void buildInBackground(const QString &datasetPath, const QStringList &fieldNames = QStringList());
+    
+    // 메모리 피처로 바로 생성
+    void build(const std::vector<HGISGdalProvider::Feature> &features, const QStringList &fieldNames);
+    
+    bool isReady() const;
+    bool isBuilding() const;
+    QStringList fieldNames() const;
+    int documentCount() const;
+    
+    // 점진 갱신 (생성 중이면 생성이 끝난 뒤 적용)
+    void updateFeature(long featureId, const QVariantMap &attributes);
+    void removeFeature(long featureId);
+    
+    // 공백으로 나눈 모든 단어를 포함하는 피처 ID (오름차순, limit > 0이면 앞에서 limit개)
+    // 단어에 초성이 있으면 초성은 음절의 초성과, 나머지 글자는 그대로 비교 ("고ㅂ" -> 고분, 고비 ...)
+    QVector<long> search(const QString &query, int limit = 0) const;
+    
+    // 한글 음절을 초성 호환 자모로 바꾼 문자열 (그 외 글자는 그대로, 길이 동일)
+    static QString initials(const QString &text);
+    
+signals:
+    void ready();
+    
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+#endif // HGISTEXTSEARCHINDEX_H
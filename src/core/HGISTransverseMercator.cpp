@@ -0,0 +1,274 @@
+#include "HGISTransverseMercator.h"
+#include <cmath>
+
+// 배열 커널은 AVX2/FMA 버전과 기본(스칼라) 버전을 함께 컴파일하고 런타임에 선택
+// (벡터 수학 함수는 -fopenmp-simd 와 glibc libmvec 를 통해 사용)
+// -ffast-math 는 쓰지 않는다: Clenshaw 합의 순서가 바뀌고 NaN/HUGE_VAL 실패 검사가 사라짐
+#if defined(__has_attribute)
+  #if __has_attribute(target_clones) && (defined(__x86_64__) || defined(__i386__)) && defined(__linux__)
+    #define HGIS_TM_MULTIVERSION __attribute__((target_clones("arch=haswell", "default")))
+  #endif
+#endif
+#ifndef HGIS_TM_MULTIVERSION
+  #define HGIS_TM_MULTIVERSION
+#endif
+
+// 배열 루프 안으로 완전히 인라인되어야 벡터화된다
+#if defined(__GNUC__)
+  #define HGIS_TM_INLINE inline __attribute__((always_inline))
+#else
+  #define HGIS_TM_INLINE inline
+#endif
+
+namespace
+{
+constexpr double kPi = 3.14159265358979323846;
+constexpr double kDegToRad = kPi / 180.0;
+constexpr int kOrder = 6;
+
+// Clenshaw 합: Σ c[j] sin(2(j+1)ζ), ζ = ξ + iη (복소수)
+// sin/cos(2ξ), sinh/cosh(2η) 는 호출부에서 넘겨받는다
+HGIS_TM_INLINE void clenshawComplex(const double *c, double s2, double c2, double sh2, double ch2,
+                                    double &outXi, double &outEta)
+{
+    // a = 2 cos(2ζ)
+    const double ar = 2.0 * c2 * ch2;
+    const double ai = -2.0 * s2 * sh2;
+
+    double y0r = 0.0, y0i = 0.0, y1r = 0.0, y1i = 0.0;
+#pragma GCC unroll 8
+    for (int j = kOrder - 1; j >= 0; --j) {
+        const double tr = ar * y0r - ai * y0i - y1r + c[j];
+        const double ti = ar * y0i + ai * y0r - y1i;
+        y1r = y0r;
+        y1i = y0i;
+        y0r = tr;
+        y0i = ti;
+    }
+
+    // sin(2ζ) * y0
+    const double sr = s2 * ch2;
+    const double si = c2 * sh2;
+    outXi = sr * y0r - si * y0i;
+    outEta = sr * y0i + si * y0r;
+}
+
+// Clenshaw 합 (실수): Σ c[j] sin(2(j+1)x), sin/cos(2x) 는 호출부에서 계산
+HGIS_TM_INLINE double clenshawReal(const double *c, double s2, double c2)
+{
+    const double a = 2.0 * c2;
+    double y0 = 0.0, y1 = 0.0;
+#pragma GCC unroll 8
+    for (int j = kOrder - 1; j >= 0; --j) {
+        const double t = a * y0 - y1 + c[j];
+        y1 = y0;
+        y0 = t;
+    }
+    return s2 * y0;
+}
+
+// tan x 로부터 sin 2x, cos 2x
+HGIS_TM_INLINE void doubleAngle(double t, double &s2, double &c2)
+{
+    const double d = 1.0 / (1.0 + t * t);
+    s2 = 2.0 * t * d;
+    c2 = (1.0 - t * t) * d;
+}
+
+// 같은 인자의 sin/cos 쌍은 컴파일러가 sincos 로 합쳐 벡터화를 막으므로
+// tan 반각 공식과 exp 기반 sinh/cosh 로 계산한다.
+// TM 정의역(|λ - λ0| <= 90°)에서는 cos λ >= 0, cos ξ' >= 0 이다.
+// 정의역 밖 좌표는 PROJ와 같이 HUGE_VAL (분기 없이 선택해 벡터화 유지)
+HGIS_TM_INLINE void tmForward(const double *alpha, double e, double qn, double zb,
+                              double lam0, double x0, double y0,
+                              double lam, double phi, double &x, double &y)
+{
+    lam -= lam0;
+    const bool inDomain = std::abs(lam) <= kPi / 2.0 && std::abs(phi) <= kPi / 2.0;
+
+    // 등각위도 tan χ = sinh(atanh(sinφ) - e·atanh(e·sinφ))
+    const double sphi = std::sin(phi);
+    const double tau = std::sinh(std::atanh(sphi) - e * std::atanh(e * sphi));
+
+    const double slam = std::sin(lam);
+    const double clam = std::sqrt(1.0 - slam * slam);
+
+    // 구면 TM 좌표 ξ' = atan2(τ, cos λ), η' = asinh(sin λ / sqrt(τ² + cos² λ))
+    const double xip = std::atan2(tau, clam);
+    const double s = slam / std::sqrt(tau * tau + clam * clam);
+    const double etap = std::asinh(s);
+
+    double s2, c2;
+    doubleAngle(tau / clam, s2, c2);
+    const double sh2 = 2.0 * s * std::sqrt(1.0 + s * s);
+    const double ch2 = 1.0 + 2.0 * s * s;
+
+    double dxi, deta;
+    clenshawComplex(alpha, s2, c2, sh2, ch2, dxi, deta);
+
+    x = inDomain ? x0 + qn * (etap + deta) : HUGE_VAL;
+    y = inDomain ? y0 + qn * (xip + dxi) + zb : HUGE_VAL;
+}
+
+HGIS_TM_INLINE void tmInverse(const double *beta, const double *delta, double qn, double zb,
+                              double lam0, double x0, double y0,
+                              double x, double y, double &lam, double &phi)
+{
+    const double xi = (y - y0 - zb) / qn;
+    const double eta = (x - x0) / qn;
+
+    double s2, c2;
+    doubleAngle(std::tan(xi), s2, c2);
+    const double e2 = std::exp(2.0 * eta);
+    const double sh2 = 0.5 * (e2 - 1.0 / e2);
+    const double ch2 = 0.5 * (e2 + 1.0 / e2);
+
+    double dxi, deta;
+    clenshawComplex(beta, s2, c2, sh2, ch2, dxi, deta);
+    const double xip = xi - dxi;
+    const double etap = eta - deta;
+
+    // sin ξ', cos ξ' (cos ξ' >= 0)
+    const double txi = std::tan(xip);
+    const double cXi = 1.0 / std::sqrt(1.0 + txi * txi);
+    const double sXi = txi * cXi;
+    const double ee = std::exp(etap);
+    const double shEta = 0.5 * (ee - 1.0 / ee);
+
+    // 등각위도 tan χ -> 측지위도
+    const double tchi = sXi / std::sqrt(shEta * shEta + cXi * cXi);
+    double sc2, cc2;
+    doubleAngle(tchi, sc2, cc2);
+    phi = std::atan(tchi) + clenshawReal(delta, sc2, cc2);
+    lam = lam0 + std::atan2(shEta, cXi);
+}
+}
+
+HGISTransverseMercator::HGISTransverseMercator() = default;
+
+HGISTransverseMercator::HGISTransverseMercator(double a, double f, double lat0, double lon0,
+                                               double k0, double x0, double y0)
+{
+    static_assert(Order == kOrder, "급수 차수 불일치");
+
+    if (a <= 0.0 || f < 0.0 || f >= 1.0 || k0 <= 0.0) {
+        return;
+    }
+
+    const double n = f / (2.0 - f);
+    const double n2 = n * n;
+    const double n3 = n2 * n;
+    const double n4 = n3 * n;
+    const double n5 = n4 * n;
+    const double n6 = n5 * n;
+
+    m_e = std::sqrt(f * (2.0 - f));
+    m_lam0 = lon0 * kDegToRad;
+    m_x0 = x0;
+    m_y0 = y0;
+
+    // 정규화 자오선 반경 A
+    const double A = a / (1.0 + n) * (1.0 + n2 / 4.0 + n4 / 64.0 + n6 / 256.0);
+    m_qn = k0 * A;
+
+    m_alpha[0] = n / 2.0 - 2.0 * n2 / 3.0 + 5.0 * n3 / 16.0 + 41.0 * n4 / 180.0
+                 - 127.0 * n5 / 288.0 + 7891.0 * n6 / 37800.0;
+    m_alpha[1] = 13.0 * n2 / 48.0 - 3.0 * n3 / 5.0 + 557.0 * n4 / 1440.0
+                 + 281.0 * n5 / 630.0 - 1983433.0 * n6 / 1935360.0;
+    m_alpha[2] = 61.0 * n3 / 240.0 - 103.0 * n4 / 140.0 + 15061.0 * n5 / 26880.0
+                 + 167603.0 * n6 / 181440.0;
+    m_alpha[3] = 49561.0 * n4 / 161280.0 - 179.0 * n5 / 168.0 + 6601661.0 * n6 / 7257600.0;
+    m_alpha[4] = 34729.0 * n5 / 80640.0 - 3418889.0 * n6 / 1995840.0;
+    m_alpha[5] = 212378941.0 * n6 / 319334400.0;
+
+    m_beta[0] = n / 2.0 - 2.0 * n2 / 3.0 + 37.0 * n3 / 96.0 - n4 / 360.0
+                - 81.0 * n5 / 512.0 + 96199.0 * n6 / 604800.0;
+    m_beta[1] = n2 / 48.0 + n3 / 15.0 - 437.0 * n4 / 1440.0 + 46.0 * n5 / 105.0
+                - 1118711.0 * n6 / 3870720.0;
+    m_beta[2] = 17.0 * n3 / 480.0 - 37.0 * n4 / 840.0 - 209.0 * n5 / 4480.0
+                + 5569.0 * n6 / 90720.0;
+    m_beta[3] = 4397.0 * n4 / 161280.0 - 11.0 * n5 / 504.0 - 830251.0 * n6 / 7257600.0;
+    m_beta[4] = 4583.0 * n5 / 161280.0 - 108847.0 * n6 / 3991680.0;
+    m_beta[5] = 20648693.0 * n6 / 638668800.0;
+
+    m_delta[0] = 2.0 * n - 2.0 * n2 / 3.0 - 2.0 * n3 + 116.0 * n4 / 45.0
+                 + 26.0 * n5 / 45.0 - 2854.0 * n6 / 675.0;
+    m_delta[1] = 7.0 * n2 / 3.0 - 8.0 * n3 / 5.0 - 227.0 * n4 / 45.0
+                 + 2704.0 * n5 / 315.0 + 2323.0 * n6 / 945.0;
+    m_delta[2] = 56.0 * n3 / 15.0 - 136.0 * n4 / 35.0 - 1262.0 * n5 / 105.0
+                 + 73814.0 * n6 / 2835.0;
+    m_delta[3] = 4279.0 * n4 / 630.0 - 332.0 * n5 / 35.0 - 399572.0 * n6 / 14175.0;
+    m_delta[4] = 4174.0 * n5 / 315.0 - 144838.0 * n6 / 6237.0;
+    m_delta[5] = 601676.0 * n6 / 22275.0;
+
+    // 원점 위도의 북부값이 0이 되도록 보정
+    double originX, originY;
+    tmForward(m_alpha, m_e, m_qn, 0.0, 0.0, 0.0, 0.0,
+              0.0, lat0 * kDegToRad, originX, originY);
+    m_zb = -originY;
+
+    m_valid = true;
+}
+
+void HGISTransverseMercator::forward(double lam, double phi, double &x, double &y) const
+{
+    tmForward(m_alpha, m_e, m_qn, m_zb, m_lam0, m_x0, m_y0, lam, phi, x, y);
+}
+
+void HGISTransverseMercator::inverse(double x, double y, double &lam, double &phi) const
+{
+    tmInverse(m_beta, m_delta, m_qn, m_zb, m_lam0, m_x0, m_y0, x, y, lam, phi);
+}
+
+HGIS_TM_MULTIVERSION
+void HGISTransverseMercator::forward(double *x, double *y, std::size_t count, std::size_t stride) const
+{
+    // 멤버를 지역 변수로 복사해 루프 벡터화를 돕는다
+    const double e = m_e, qn = m_qn, zb = m_zb, lam0 = m_lam0, x0 = m_x0, y0 = m_y0;
+    double alpha[kOrder];
+    for (int j = 0; j < kOrder; ++j) {
+        alpha[j] = m_alpha[j];
+    }
+
+#pragma omp simd
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::size_t k = i * stride;
+        double ox, oy;
+        tmForward(alpha, e, qn, zb, lam0, x0, y0, x[k], y[k], ox, oy);
+        x[k] = ox;
+        y[k] = oy;
+    }
+}
+
+HGIS_TM_MULTIVERSION
+void HGISTransverseMercator::inverse(double *x, double *y, std::size_t count, std::size_t stride) const
+{
+    const double qn = m_qn, zb = m_zb, lam0 = m_lam0, x0 = m_x0, y0 = m_y0;
+    double beta[kOrder], delta[kOrder];
+    for (int j = 0; j < kOrder; ++j) {
+        beta[j] = m_beta[j];
+        delta[j] = m_delta[j];
+    }
+
+#pragma omp simd
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::size_t k = i * stride;
+        double lam, phi;
+        tmInverse(beta, delta, qn, zb, lam0, x0, y0, x[k], y[k], lam, phi);
+        x[k] = lam;
+        y[k] = phi;
+    }
+}
+
+const char *HGISTransverseMercator::kernelName()
+{
+#if defined(__has_attribute)
+  #if __has_attribute(target_clones) && (defined(__x86_64__) || defined(__i386__)) && defined(__linux__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return "avx2";
+    }
+  #endif
+#endif
+    return "scalar";
+}
@@ -0,0 +1,71 @@
+#ifndef HGISTRANSVERSEMERCATOR_H
+#define HGISTRANSVERSEMERCATOR_H
+
+#include <QtGlobal>
+#include <cstddef>
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+/**
+ * 횡메르카토르(TM) 투영 커널
+ * Krüger 6차 급수 (Karney 2011, PROJ tmerc와 동일 계열) 구현으로
+ * 중앙자오선에서 수백 km 이내에서는 PROJ 결과와 서브밀리미터 수준으로 일치한다.
+ * Korea 2000 (EPSG:5179, 5185~5188) / Korean 1985 (EPSG:5173~5178) 변환 전용 고속 경로.
+ */
+class CORE_EXPORT HGISTransverseMercator
+{
+public:
+    HGISTransverseMercator();
+
+    /**
+     * 생성자
+     * @param a 타원체 장반경 (m)
+     * @param f 편평률
+     * @param lat0 원점 위도 (도)
+     * @param lon0 중앙자오선 (도)
+     * @param k0 축척계수
+     * @param x0 가산 동부값 (m)
+     * @param y0 가산 북부값 (m)
+     */
+    HGISTransverseMercator(double a, double f, double lat0, double lon0,
+                           double k0, double x0, double y0);
+
+    bool isValid() const { return m_valid; }
+
+    // 단일 좌표 (경위도는 라디안)
+    void forward(double lam, double phi, double &x, double &y) const;
+    void inverse(double x, double y, double &lam, double &phi) const;
+
+    /**
+     * 배열 제자리 변환
+     * @param x 경도(라디안) 또는 동부값 배열
+     * @param y 위도(라디안) 또는 북부값 배열
+     * @param count 좌표 개수
+     * @param stride 좌표 사이 간격 (double 단위, QPointF 배열은 2)
+     */
+    void forward(double *x, double *y, std::size_t count, std::size_t stride = 1) const;
+    void inverse(double *x, double *y, std::size_t count, std::size_t stride = 1) const;
+
+    // 현재 빌드에서 선택된 배열 커널 이름 ("avx2" 또는 "scalar")
+    static const char *kernelName();
+
+private:
+    static constexpr int Order = 6;
+
+    double m_lam0 = 0.0;
+    double m_x0 = 0.0;
+    double m_y0 = 0.0;
+    double m_e = 0.0;           // 이심률
+    double m_qn = 0.0;          // k0 * 정규화 자오선 반경
+    double m_zb = 0.0;          // 원점 위도에 대한 북부 보정
+    double m_alpha[Order] = {}; // 정방향 Krüger 계수
+    double m_beta[Order] = {};  // 역방향 Krüger 계수
+    double m_delta[Order] = {}; // 등각위도 -> 측지위도 계수
+    bool m_valid = false;
+};
+
+#endif // HGISTRANSVERSEMERCATOR_H
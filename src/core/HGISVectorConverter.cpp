@@ -0,0 +1,447 @@
+#include "HGISVectorConverter.h"
+#include "HGISCoordinateTransform.h"
+#include "HGISWorkerPool.h"
+#include "providers/HGISGdalProvider.h"
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QThread>
+#include <gdal.h>
+#include <ogr_api.h>
+#include <ogr_srs_api.h>
+#include <cpl_string.h>
+#include <cmath>
+#include <deque>
+#include <future>
+#include <vector>
+
+namespace
+{
+// 작업 스레드에 넘기는 피처 묶음 (피처는 쓰기가 끝난 뒤 해제)
+struct Batch {
+    std::vector<OGRFeatureH> features;
+    long failures = 0;
+};
+
+// 멀티 지오메트리/폴리곤 링을 좌표 배열을 가진 단순 지오메트리로 펼침
+void collectParts(OGRGeometryH geometry, std::vector<OGRGeometryH> &parts)
+{
+    const int count = OGR_G_GetGeometryCount(geometry);
+    if (count > 0) {
+        for (int i = 0; i < count; ++i) {
+            collectParts(OGR_G_GetGeometryRef(geometry, i), parts);
+        }
+    } else if (OGR_G_GetPointCount(geometry) > 0) {
+        parts.push_back(geometry);
+    }
+}
+
+// 묶음 전체 좌표를 한 배열에 모아 한 번에 변환한 뒤 되돌려 씀
+void transformBatch(Batch &batch, const HGISCoordinateTransform &transform)
+{
+    std::vector<OGRGeometryH> parts;
+    std::vector<std::size_t> featurePartEnd;    // 피처별 마지막 부분 지오메트리 다음 위치
+    featurePartEnd.reserve(batch.features.size());
+    
+    for (OGRFeatureH feature : batch.features) {
+        OGRGeometryH geometry = OGR_F_GetGeometryRef(feature);
+        if (geometry) {
+            collectParts(geometry, parts);
+        }
+        featurePartEnd.push_back(parts.size());
+    }
+    
+    std::vector<std::size_t> offsets(parts.size() + 1, 0);
+    for (std::size_t i = 0; i < parts.size(); ++i) {
+        offsets[i + 1] = offsets[i] + OGR_G_GetPointCount(parts[i]);
+    }
+    
+    const std::size_t total = offsets.back();
+    if (total == 0) {
+        return;
+    }
+    
+    std::vector<double> xs(total);
+    std::vector<double> ys(total);
+    std::vector<double> zs(total, 0.0);
+    for (std::size_t i = 0; i < parts.size(); ++i) {
+        const bool hasZ = OGR_G_GetCoordinateDimension(parts[i]) == 3;
+        OGR_G_GetPoints(parts[i],
+                        &xs[offsets[i]], sizeof(double),
+                        &ys[offsets[i]], sizeof(double),
+                        hasZ ? &zs[offsets[i]] : nullptr, sizeof(double));
+    }
+    
+    transform.transformCoordinates(xs.data(), ys.data(), total);
+    
+    std::size_t part = 0;
+    for (std::size_t f = 0; f < batch.features.size(); ++f) {
+        const std::size_t firstPart = part;
+        bool failed = false;
+        for (std::size_t k = offsets[firstPart]; k < offsets[featurePartEnd[f]]; ++k) {
+            if (xs[k] == HUGE_VAL || ys[k] == HUGE_VAL) {
+                failed = true;
+                break;
+            }
+        }
+        
+        if (failed) {
+            // 잘못된 좌표를 기록하지 않도록 지오메트리 제거
+            OGR_F_SetGeometryDirectly(batch.features[f], nullptr);
+            ++batch.failures;
+            part = featurePartEnd[f];
+            continue;
+        }
+        
+        for (; part < featurePartEnd[f]; ++part) {
+            const bool hasZ = OGR_G_GetCoordinateDimension(parts[part]) == 3;
+            const std::size_t offset = offsets[part];
+            OGR_G_SetPoints(parts[part], static_cast<int>(offsets[part + 1] - offset),
+                            &xs[offset], sizeof(double),
+                            &ys[offset], sizeof(double),
+                            hasZ ? &zs[offset] : nullptr, sizeof(double));
+        }
+    }
+}
+
+void destroyFeatures(std::vector<OGRFeatureH> &features)
+{
+    for (OGRFeatureH feature : features) {
+        OGR_F_Destroy(feature);
+    }
+    features.clear();
+}
+}
+
+class HGISVectorConverter::Private
+{
+public:
+    long featuresWritten = 0;
+    long transformFailures = 0;
+    double elapsedSeconds = 0.0;
+    QString errorMessage;
+    
+    GDALDatasetH output = nullptr;
+    OGRLayerH outputLayer = nullptr;
+    bool inTransaction = false;
+    long sinceCommit = 0;
+    
+    void reset()
+    {
+        featuresWritten = 0;
+        transformFailures = 0;
+        elapsedSeconds = 0.0;
+        errorMessage.clear();
+        output = nullptr;
+        outputLayer = nullptr;
+        inTransaction = false;
+        sinceCommit = 0;
+    }
+    
+    bool fail(const QString &message)
+    {
+        errorMessage = message;
+        qWarning() << message;
+        return false;
+    }
+    
+    OGRSpatialReferenceH createSpatialReference(const HGISCoordinateReferenceSystem &crs) const
+    {
+        OGRSpatialReferenceH srs = OSRNewSpatialReference(nullptr);
+        OGRErr err;
+        if (crs.epsgCode() > 0) {
+            err = OSRImportFromEPSG(srs, crs.epsgCode());
+        } else {
+            QByteArray wkt = crs.toWkt().toUtf8();
+            err = OSRSetFromUserInput(srs, wkt.constData());
+        }
+        
+        if (err != OGRERR_NONE) {
+            OSRDestroySpatialReference(srs);
+            return nullptr;
+        }
+
+#if GDAL_VERSION_MAJOR >= 3
+        // HGISCoordinateTransform과 같은 경도/위도 (x/y) 순서
+        OSRSetAxisMappingStrategy(srs, OAMS_TRADITIONAL_GIS_ORDER);
+#endif
+        return srs;
+    }
+    
+    bool createOutput(const QString &outputPath, const QString &driverName, bool overwrite,
+                      OGRLayerH sourceLayer, const QString &layerName, OGRSpatialReferenceH srs)
+    {
+        GDALDriverH driver = GDALGetDriverByName(driverName.toUtf8().constData());
+        if (!driver) {
+            return fail(QString("지원하지 않는 출력 포맷입니다: %1").arg(driverName));
+        }
+        
+        QByteArray path = outputPath.toUtf8();
+        if (QFileInfo::exists(outputPath)) {
+            if (!overwrite) {
+                return fail(QString("출력 파일이 이미 있습니다: %1").arg(outputPath));
+            }
+            GDALDeleteDataset(driver, path.constData());
+        }
+        
+        output = GDALCreate(driver, path.constData(), 0, 0, 0, GDT_Unknown, nullptr);
+        if (!output) {
+            return fail(QString("출력 파일을 만들 수 없습니다: %1").arg(outputPath));
+        }
+        
+        char **layerOptions = nullptr;
+        if (driverName == "ESRI Shapefile") {
+            layerOptions = CSLSetNameValue(layerOptions, "ENCODING", "UTF-8");
+        }
+        
+        OGRFeatureDefnH sourceDefn = OGR_L_GetLayerDefn(sourceLayer);
+        outputLayer = GDALDatasetCreateLayer(output, layerName.toUtf8().constData(), srs,
+                                             OGR_FD_GetGeomType(sourceDefn), layerOptions);
+        CSLDestroy(layerOptions);
+        
+        if (!outputLayer) {
+            return fail(QString("출력 레이어를 만들 수 없습니다: %1").arg(layerName));
+        }
+        
+        for (int i = 0; i < OGR_FD_GetFieldCount(sourceDefn); ++i) {
+            if (OGR_L_CreateField(outputLayer, OGR_FD_GetFieldDefn(sourceDefn, i), TRUE) != OGRERR_NONE) {
+                return fail(QString("필드를 만들 수 없습니다: %1")
+                            .arg(QString::fromUtf8(OGR_Fld_GetNameRef(OGR_FD_GetFieldDefn(sourceDefn, i)))));
+            }
+        }
+        
+        // 트랜잭션을 지원하지 않는 포맷 (Shapefile 등)은 그대로 기록
+        inTransaction = GDALDatasetStartTransaction(output, FALSE) == OGRERR_NONE;
+        return true;
+    }
+    
+    bool writeBatch(Batch &batch, int transactionSize)
+    {
+        OGRFeatureDefnH outputDefn = OGR_L_GetLayerDefn(outputLayer);
+        bool ok = errorMessage.isEmpty();
+        
+        for (OGRFeatureH feature : batch.features) {
+            if (ok) {
+                OGRFeatureH outFeature = OGR_F_Create(outputDefn);
+                OGR_F_SetFrom(outFeature, feature, TRUE);
+                OGR_F_SetFID(outFeature, OGRNullFID);
+                
+                if (OGR_L_CreateFeature(outputLayer, outFeature) != OGRERR_NONE) {
+                    ok = fail(QString("피처를 기록할 수 없습니다 (FID %1)").arg(OGR_F_GetFID(feature)));
+                } else {
+                    ++featuresWritten;
+                    ++sinceCommit;
+                }
+                OGR_F_Destroy(outFeature);
+            }
+        }
+        
+        transformFailures += batch.failures;
+        destroyFeatures(batch.features);
+        
+        if (ok && inTransaction && sinceCommit >= transactionSize) {
+            if (GDALDatasetCommitTransaction(output) != OGRERR_NONE) {
+                inTransaction = false;
+                return fail("트랜잭션을 커밋할 수 없습니다");
+            }
+            sinceCommit = 0;
+            inTransaction = GDALDatasetStartTransaction(output, FALSE) == OGRERR_NONE;
+        }
+        
+        return ok;
+    }
+    
+    bool closeOutput()
+    {
+        bool ok = true;
+        if (output) {
+            if (inTransaction && GDALDatasetCommitTransaction(output) != OGRERR_NONE) {
+                ok = fail("트랜잭션을 커밋할 수 없습니다");
+            }
+            GDALClose(output);
+        }
+        output = nullptr;
+        outputLayer = nullptr;
+        inTransaction = false;
+        return ok;
+    }
+};
+
+HGISVectorConverter::HGISVectorConverter(QObject *parent)
+    : QObject(parent)
+    , d(std::make_unique<Private>())
+{
+}
+
+HGISVectorConverter::~HGISVectorConverter() = default;
+
+bool HGISVectorConverter::convert(const QString &inputPath, const QString &outputPath, const Options &options)
+{
+    d->reset();
+    
+    QElapsedTimer timer;
+    timer.start();
+    
+    HGISGdalProvider provider(inputPath);
+    if (!provider.open()) {
+        return d->fail(provider.errorMessage());
+    }
+    
+    // 좌표계 결정
+    HGISCoordinateReferenceSystem sourceCrs = options.sourceCrs;
+    if (!sourceCrs.isValid()) {
+        sourceCrs = provider.epsgCode() > 0 ? HGISCoordinateReferenceSystem(provider.epsgCode())
+                                            : HGISCoordinateReferenceSystem(provider.crs());
+    }
+    
+    const bool reproject = options.targetCrs.isValid() && options.targetCrs != sourceCrs;
+    if (reproject && !sourceCrs.isValid()) {
+        return d->fail(QString("원본 좌표계를 알 수 없습니다: %1").arg(inputPath));
+    }
+    
+    HGISCoordinateTransform prototype;
+    if (reproject) {
+        prototype = HGISCoordinateTransform(sourceCrs, options.targetCrs);
+        if (!prototype.isValid()) {
+            return d->fail(QString("좌표 변환을 만들 수 없습니다: %1").arg(prototype.lastError()));
+        }
+    }
+    
+    QString driverName = options.format.isEmpty() ? driverForPath(outputPath) : options.format;
+    if (driverName.isEmpty()) {
+        return d->fail(QString("출력 포맷을 알 수 없습니다: %1").arg(outputPath));
+    }
+    
+    OGRSpatialReferenceH srs = nullptr;
+    const HGISCoordinateReferenceSystem &outputCrs = reproject ? options.targetCrs : sourceCrs;
+    if (outputCrs.isValid()) {
+        srs = d->createSpatialReference(outputCrs);
+    }
+    
+    bool created = d->createOutput(outputPath, driverName, options.overwrite, provider.layerHandle(),
+                                   QFileInfo(outputPath).completeBaseName(), srs);
+    if (srs) {
+        OSRDestroySpatialReference(srs);
+    }
+    if (!created) {
+        d->closeOutput();
+        return false;
+    }
+    
+    const int threadCount = options.threadCount > 0 ? options.threadCount : QThread::idealThreadCount();
+    const std::size_t batchSize = static_cast<std::size_t>(qMax(1, options.batchSize));
+    const int transactionSize = qMax(1, options.transactionSize);
+    const long total = provider.featureCount();
+    
+    // 변환 작업 스레드는 변환 동안 threadCount개로 고정 (묶음마다 스레드를 만들지 않음)
+    // PROJ 객체는 스레드 간에 공유할 수 없으므로 작업 스레드마다 변환 객체를 하나씩 둠
+    std::vector<std::unique_ptr<HGISCoordinateTransform>> transforms;
+    std::unique_ptr<HGISWorkerPool> workers;
+    if (reproject) {
+        workers = std::make_unique<HGISWorkerPool>(threadCount);
+        for (int i = 0; i < workers->threadCount(); ++i) {
+            transforms.push_back(std::make_unique<HGISCoordinateTransform>(prototype));
+        }
+    }
+    
+    // 읽기 -> (작업 스레드) 좌표 변환 -> 순서대로 쓰기
+    // 최대 threadCount개의 묶음을 동시에 변환하며, 가장 오래된 묶음부터 기록
+    std::deque<std::future<Batch>> inFlight;
+    bool ok = true;
+    
+    auto write = [&](Batch batch) {
+        ok = d->writeBatch(batch, transactionSize) && ok;
+        const double seconds = timer.elapsed() / 1000.0;
+        emit progress(d->featuresWritten, total, seconds > 0 ? d->featuresWritten / seconds : 0.0);
+    };
+    
+    long read = provider.readFeatureBatches(batchSize, [&](std::vector<OGRFeatureH> &features) {
+        Batch batch;
+        batch.features.swap(features);
+        
+        if (!workers) {
+            write(std::move(batch));
+            return ok;
+        }
+        
+        if (static_cast<int>(inFlight.size()) >= threadCount) {
+            write(inFlight.front().get());
+            inFlight.pop_front();
+        }
+        
+        inFlight.push_back(workers->submit([&transforms, batch = std::move(batch)](int worker) mutable {
+            transformBatch(batch, *transforms[worker]);
+            return std::move(batch);
+        }));
+        return ok;
+    });
+    
+    // 남은 묶음 기록 (실패한 경우에도 피처 해제를 위해 모두 회수)
+    while (!inFlight.empty()) {
+        write(inFlight.front().get());
+        inFlight.pop_front();
+    }
+    
+    ok = d->closeOutput() && ok;
+    d->elapsedSeconds = timer.elapsed() / 1000.0;
+    
+    if (read < 0) {
+        return d->fail(QString("피처를 읽을 수 없습니다: %1").arg(inputPath));
+    }
+    
+    if (ok) {
+        qInfo() << "변환 완료:" << inputPath << "->" << outputPath
+                << "피처 수:" << d->featuresWritten
+                << "소요 시간:" << d->elapsedSeconds << "초";
+        if (d->transformFailures > 0) {
+            qWarning() << "좌표 변환 실패로 지오메트리 없이 기록된 피처:" << d->transformFailures;
+        }
+    }
+    
+    return ok;
+}
+
+long HGISVectorConverter::featuresWritten() const
+{
+    return d->featuresWritten;
+}
+
+long HGISVectorConverter::transformFailures() const
+{
+    return d->transformFailures;
+}
+
+double HGISVectorConverter::elapsedSeconds() const
+{
+    return d->elapsedSeconds;
+}
+
+QString HGISVectorConverter::errorMessage() const
+{
+    return d->errorMessage;
+}
+
+QString HGISVectorConverter::driverForPath(const QString &path)
+{
+    const QString ext = QFileInfo(path).suffix().toLower();
+    
+    if (ext == "shp") {
+        return "ESRI Shapefile";
+    } else if (ext == "gpkg") {
+        return "GPKG";
+    } else if (ext == "geojson" || ext == "json") {
+        return "GeoJSON";
+    } else if (ext == "kml") {
+        return "KML";
+    } else if (ext == "gml") {
+        return "GML";
+    } else if (ext == "sqlite") {
+        return "SQLite";
+    } else if (ext == "tab") {
+        return "MapInfo File";
+    } else if (ext == "csv") {
+        return "CSV";
+    }
+    
+    return QString();
+}
@@ -0,0 +1,51 @@
+#ifndef HGISVECTORCONVERTER_H
+#define HGISVECTORCONVERTER_H
+
+#include <QObject>
+#include <QString>
+#include <memory>
+#include "HGISCoordinateReferenceSystem.h"
+
+// 벡터 데이터 일괄 변환 (좌표계 재투영 + 포맷 변환)
+// 원본을 묶음 단위로 스트리밍하며 읽고, 좌표 변환은 작업 스레드에서 묶음별로 병렬 처리,
+// 쓰기는 읽은 순서대로 큰 트랜잭션 단위로 수행
+class CORE_EXPORT HGISVectorConverter : public QObject
+{
+    Q_OBJECT
+    
+public:
+    struct Options {
+        QString format;                             // OGR 드라이버 이름 (비어 있으면 출력 확장자로 판단)
+        HGISCoordinateReferenceSystem sourceCrs;    // 무효면 원본 레이어의 좌표계 사용
+        HGISCoordinateReferenceSystem targetCrs;    // 무효면 재투영 없이 포맷만 변환
+        int threadCount = 0;                        // 0이면 CPU 코어 수
+        int batchSize = 4096;                       // 작업 스레드 하나가 처리하는 피처 수
+        int transactionSize = 100000;               // 트랜잭션당 피처 수
+        bool overwrite = false;                     // 출력 파일이 있으면 덮어쓰기
+    };
+    
+    explicit HGISVectorConverter(QObject *parent = nullptr);
+    ~HGISVectorConverter();
+    
+    // 변환 실행 (완료될 때까지 반환하지 않음)
+    bool convert(const QString &inputPath, const QString &outputPath, const Options &options);
+    
+    // 마지막 변환 결과
+    long featuresWritten() const;
+    long transformFailures() const;    // 좌표 변환에 실패해 지오메트리 없이 기록된 피처 수
+    double elapsedSeconds() const;
+    QString errorMessage() const;
+    
+    // 출력 확장자에 해당하는 OGR 드라이버 이름 (알 수 없으면 빈 문자열)
+    static QString driverForPath(const QString &path);
+    
+signals:
+    // 묶음을 기록할 때마다 발생
+    void progress(long processed, long total, double featuresPerSecond);
+    
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+#endif // HGISVECTORCONVERTER_H
@@ -1,10 +1,114 @@
 #include "HGISVectorLayer.h"
+#include "HGISCacheManager.h"
 #include "HGISCoordinateTransform.h"
+#include "HGISGeometryClipper.h"
 #include <QPainter>
 #include <QPainterPath>
 #include <QDebug>
 #include <QFileInfo>
+#include <QFile>
+#include <QHash>
+#include <ogr_api.h>
+#include <algorithm>
 #include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+
+namespace
+{
+// 보이지 않는 레이어의 좌표를 압축할 때 격자 (지상 1mm)
+constexpr double kColdResolutionMeters = 0.001;
+
+// 선/다각형을 자를 범위 = 화면 범위 + 긴 변의 2%
+constexpr double kClipMarginRatio = 0.02;
+
+// 범위가 이보다 작은 피처는 장치 픽셀 하나로 그림 (픽셀 단위)
+constexpr double kSubPixelSize = 1.0;
+
+// 점 군집 반경 (화면 픽셀)
+constexpr double kClusterRadiusPixels = 40.0;
+
+// 2^16 x 2^16 격자 점의 힐베르트 곡선 위 순번
+quint64 hilbertIndex(quint32 x, quint32 y)
+{
+    constexpr quint32 n = 1u << 16;
+    quint64 index = 0;
+    for (quint32 s = n / 2; s > 0; s /= 2) {
+        const quint32 rx = (x & s) ? 1 : 0;
+        const quint32 ry = (y & s) ? 1 : 0;
+        index += static_cast<quint64>(s) * s * ((3 * rx) ^ ry);
+        
+        // 사분면 회전
+        if (ry == 0) {
+            if (rx == 1) {
+                x = n - 1 - x;
+                y = n - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return index;
+}
+
+// 피처를 범위 중심의 힐베르트 순번으로 정렬 (가까운 피처가 메모리에서도 이웃하도록)
+// 순번이 같으면 파일 순서 유지, 좌표가 없는 피처는 맨 뒤
+void sortByHilbert(std::vector<HGISGdalProvider::Feature> &features)
+{
+    const std::size_t count = features.size();
+    std::vector<QPointF> centers(count);
+    std::vector<bool> located(count, false);
+    double minX = std::numeric_limits<double>::max();
+    double minY = std::numeric_limits<double>::max();
+    double maxX = -std::numeric_limits<double>::max();
+    double maxY = -std::numeric_limits<double>::max();
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::vector<QPointF> &geometry = features[i].geometry;
+        if (geometry.empty()) {
+            continue;
+        }
+        double left = geometry.front().x(), right = left;
+        double top = geometry.front().y(), bottom = top;
+        for (const QPointF &point : geometry) {
+            left = std::min(left, point.x());
+            right = std::max(right, point.x());
+            top = std::min(top, point.y());
+            bottom = std::max(bottom, point.y());
+        }
+        centers[i] = QPointF((left + right) * 0.5, (top + bottom) * 0.5);
+        located[i] = true;
+        minX = std::min(minX, centers[i].x());
+        minY = std::min(minY, centers[i].y());
+        maxX = std::max(maxX, centers[i].x());
+        maxY = std::max(maxY, centers[i].y());
+    }
+    
+    // 중심들의 범위를 격자에 맞춤 (한 축 범위가 0이어도 나누지 않도록)
+    constexpr double kGridMax = 65535.0;
+    const double scaleX = maxX > minX ? kGridMax / (maxX - minX) : 0.0;
+    const double scaleY = maxY > minY ? kGridMax / (maxY - minY) : 0.0;
+    std::vector<quint64> keys(count, std::numeric_limits<quint64>::max());
+    for (std::size_t i = 0; i < count; ++i) {
+        if (located[i]) {
+            keys[i] = hilbertIndex(static_cast<quint32>((centers[i].x() - minX) * scaleX),
+                                   static_cast<quint32>((centers[i].y() - minY) * scaleY));
+        }
+    }
+    
+    std::vector<std::size_t> order(count);
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    std::stable_sort(order.begin(), order.end(), [&keys](std::size_t a, std::size_t b) {
+        return keys[a] < keys[b];
+    });
+    
+    std::vector<HGISGdalProvider::Feature> sorted;
+    sorted.reserve(count);
+    for (std::size_t i : order) {
+        sorted.push_back(std::move(features[i]));
+    }
+    features.swap(sorted);
+}
+}
 
 class HGISVectorLayer::Private
 {
@@ -23,9 +127,490 @@ public:
     // 선택된 피처
     QSet<long> selectedFeatureIds;
     
-    // 캐시된 피처
-    mutable std::vector<HGISGdalProvider::Feature> cachedFeatures;
+    // 캐시된 피처 (공유 불변 목록 - 바뀌면 새 목록으로 교체)
+    mutable HGISFeatureSnapshot cachedFeatures;
     mutable bool featuresCached = false;
+    mutable QHash<long, std::size_t> featurePositions;  // FID -> cachedFeatures 위치
+    int cacheId = -1;                                   // 캐시 관리자 등록 ID
+    
+    // 읽어 둔 피처의 좌표 저장 방식
+    HGISCoordinateEncoding coordinateEncoding = HGISCoordinateEncoding::Double;
+    double coordinateResolution = 0.001;
+    
+    // 읽을 때 피처를 공간 순서(힐베르트 곡선)로 다시 배열할지
+    bool spatialOrdering = false;
+    
+    // 값 종류가 적은 문자열 필드의 사전 부호화 열 (행 순서 = cachedFeatures 순서)
+    mutable QHash<QString, HGISDictionaryColumn> dictionaryColumns;
+    
+    // 캐시된 필드 통계
+    mutable QHash<QString, HGISFieldStatistics> statisticsCache;
+    mutable QHash<QString, HGISFieldStatistics> summaryCache;
+    
+    // 필드별 속성 색인
+    QHash<QString, std::shared_ptr<const HGISAttributeIndex>> attributeIndexes;
+    
+    // 외부 표 조인
+    struct LayerJoin {
+        QString targetField;
+        QString prefix;
+        std::shared_ptr<const HGISAttributeJoin> table;
+    };
+    QVector<LayerJoin> joins;
+    QStringList joinedFieldNames;                   // 가상 열 (추가 순서)
+    QHash<QString, QPair<int, int>> joinedColumns;  // 가상 열 -> (조인, 표 필드)
+    
+    // 전체 텍스트 검색 색인 (레이어가 소유)
+    HGISTextSearchIndex *textIndex = nullptr;
+    QStringList textSearchFields;
+    
+    // 점 군집 계층 (레이어가 소유)
+    HGISPointClusterIndex *clusterIndex = nullptr;
+    
+    // 열 지도 - 점은 렌더링 좌표계로 바꿔 한 번 넘기고, 피처 목록/좌표계/가중치 필드가 바뀌면 다시 넘김
+    HGISHeatmapRenderer heatmap;
+    QString heatmapWeightField;
+    bool heatmapPointsValid = false;
+    std::uint64_t heatmapGeneration = 0;     // 점을 만든 피처 목록 (스냅샷은 붙잡지 않음)
+    HGISCoordinateReferenceSystem heatmapCrs;
+    
+    // 한 픽셀보다 작은 피처를 모을 때 쓰는 장치 픽셀 점유 표시 (프레임마다 다시 할당하지 않음)
+    // 다음 프레임 시작 때 이번에 표시한 픽셀만 지움
+    std::vector<bool> occupiedPixels;
+    std::vector<std::size_t> claimedPixels;
+    QSize occupiedSize;
+    
+    void resetOccupiedPixels(const QSize &size)
+    {
+        if (size != occupiedSize) {
+            occupiedPixels.assign(static_cast<std::size_t>(size.width()) * size.height(), false);
+            occupiedSize = size;
+        } else {
+            for (std::size_t index : claimedPixels) {
+                occupiedPixels[index] = false;
+            }
+        }
+        claimedPixels.clear();
+    }
+    
+    // 실시간 재투영 (레이어 CRS -> 렌더링 CRS)
+    HGISCoordinateReferenceSystem renderCrs;
+    HGISCoordinateTransform renderTransform;
+    HGISCoordinateTransform inverseRenderTransform;
+    
+    // FID로 읽어 둔 피처의 위치 찾기 (없으면 -1)
+    long cachedRow(long featureId) const
+    {
+        if (featurePositions.size() != static_cast<int>(cachedFeatures.size())) {
+            featurePositions.clear();
+            featurePositions.reserve(static_cast<int>(cachedFeatures.size()));
+            for (std::size_t i = 0; i < cachedFeatures.size(); ++i) {
+                featurePositions.insert(cachedFeatures[i].id, i);
+            }
+        }
+        
+        auto it = featurePositions.constFind(featureId);
+        return it != featurePositions.constEnd() ? static_cast<long>(it.value()) : -1;
+    }
+    
+    // FID로 읽어 둔 피처 찾기
+    const HGISGdalProvider::Feature *cachedFeature(long featureId) const
+    {
+        const long row = cachedRow(featureId);
+        return row >= 0 ? &cachedFeatures[static_cast<std::size_t>(row)] : nullptr;
+    }
+    
+    // 메모리 사용량 추정 (속성은 고르게 뽑은 표본으로 추정)
+    HGISCacheUsage cacheUsage() const
+    {
+        HGISCacheUsage usage;
+        
+        if (featuresCached) {
+            usage.geometryBytes = static_cast<qint64>(cachedFeatures.features().capacity()
+                                                      * sizeof(HGISGdalProvider::Feature));
+            if (const HGISGeometryStore *store = cachedFeatures.geometryStore()) {
+                usage.geometryBytes += store->memoryUsage();
+            }
+            
+            constexpr std::size_t kSampleSize = 1024;
+            const std::size_t step = std::max<std::size_t>(1, cachedFeatures.size() / kSampleSize);
+            qint64 sampleBytes = 0;
+            std::size_t sampled = 0;
+            for (std::size_t i = 0; i < cachedFeatures.size(); i += step, ++sampled) {
+                const QVariantMap &attributes = cachedFeatures[i].attributes;
+                for (auto it = attributes.constBegin(); it != attributes.constEnd(); ++it) {
+                    // QMap 노드 + 문자열 값 (필드 이름 키는 제공자의 문자열, 부호화한 값은 사전의 문자열을 공유)
+                    sampleBytes += 48;
+                    if (it.value().type() == QVariant::String && !dictionaryColumns.contains(it.key())) {
+                        sampleBytes += 24 + it.value().toString().capacity() * 2;
+                    }
+                }
+            }
+            if (sampled > 0) {
+                usage.attributeBytes = sampleBytes * static_cast<qint64>(cachedFeatures.size())
+                                       / static_cast<qint64>(sampled);
+            }
+            usage.indexBytes = static_cast<qint64>(featurePositions.size()) * 32;
+            for (const HGISDictionaryColumn &column : dictionaryColumns) {
+                usage.attributeBytes += column.memoryUsage();
+            }
+        }
+        
+        for (const auto &index : attributeIndexes) {
+            usage.indexBytes += index->memoryUsage();
+        }
+        for (const LayerJoin &join : joins) {
+            usage.indexBytes += join.table->memoryUsage();
+        }
+        return usage;
+    }
+    
+    void reportCacheUsage() const
+    {
+        HGISCacheManager::instance()->updateUsage(cacheId, cacheUsage());
+    }
+    
+    // 읽어 둔 피처를 쓸 수 있는지 (쓸 수 있으면 최근 사용으로 표시)
+    bool useCachedFeatures() const
+    {
+        if (featuresCached) {
+            HGISCacheManager::instance()->touch(cacheId);
+        }
+        return featuresCached;
+    }
+    
+    // 피처 캐시 비우기 (제공자에서 다시 읽을 수 있음), 남은 사용량 반환
+    // 밖에서 들고 있는 스냅샷은 마지막 스냅샷이 사라질 때 해제됨
+    HGISCacheUsage releaseFeatureCache()
+    {
+        cachedFeatures = HGISFeatureSnapshot();
+        featuresCached = false;
+        dictionaryColumns.clear();
+        featurePositions = QHash<long, std::size_t>();
+        heatmapPointsValid = false;
+        heatmapGeneration = 0;
+        return cacheUsage();
+    }
+    
+    // 압축 저장 격자 (레이어 단위) - 양자화 레이어는 같은 격자를 써서 압축/해제에 손실이 없게 함
+    double coldResolution(const HGISCoordinateReferenceSystem &crs) const
+    {
+        if (coordinateEncoding == HGISCoordinateEncoding::Quantized) {
+            return coordinateResolution;
+        }
+        return kColdResolutionMeters / crs.metersPerUnit();
+    }
+    
+    // 좌표 저장소만 다른 방식으로 다시 만든 스냅샷으로 교체
+    // 피처 목록과 FID 위치, 사전 부호화 열은 그대로 공유하고 밖에서 들고 있는 스냅샷도 그대로 유효
+    void recodeGeometry(HGISCoordinateEncoding encoding, double resolution) const
+    {
+        const HGISGeometryStore *store = cachedFeatures.geometryStore();
+        if (!featuresCached || !store || store->encoding() == encoding) {
+            return;
+        }
+        
+        auto recoded = std::make_shared<HGISGeometryStore>();
+        recoded->build(*store, encoding, resolution);
+        cachedFeatures = cachedFeatures.withGeometryStore(recoded);
+        HGISCacheManager::instance()->updateUsage(cacheId, cacheUsage());
+    }
+    
+    // 보이지 않게 된 레이어의 좌표를 차분 varint로 압축
+    void compressGeometry(const HGISCoordinateReferenceSystem &crs) const
+    {
+        recodeGeometry(HGISCoordinateEncoding::Compressed, coldResolution(crs));
+    }
+    
+    // 다시 보일 때 레이어의 저장 방식으로 풂 (레이어 자체가 압축 저장이면 그대로)
+    void decompressGeometry() const
+    {
+        const HGISGeometryStore *store = cachedFeatures.geometryStore();
+        if (store && store->encoding() == HGISCoordinateEncoding::Compressed) {
+            recodeGeometry(coordinateEncoding, coordinateResolution);
+        }
+    }
+    
+    // 열 지도에 넘길 점 (피처 범위 중심, 렌더링 좌표계)과 가중치
+    void prepareHeatmapPoints(const HGISFeatureSnapshot &snapshot)
+    {
+        if (heatmapPointsValid && snapshot.generation() == heatmapGeneration && heatmapCrs == renderCrs) {
+            return;
+        }
+        
+        // 점은 축척이 바뀌어도 다시 쓰므로 현재 화면 축척의 근사 격자가 아닌 정확한 변환으로 계산
+        HGISCoordinateTransform transform(renderTransform);
+        transform.clearApproximation();
+        
+        const HGISGeometryStore *store = snapshot.geometryStore();
+        std::vector<QPointF> points;
+        std::vector<float> weights;
+        points.reserve(snapshot.size());
+        weights.reserve(snapshot.size());
+        for (std::size_t row = 0; store && row < snapshot.size(); ++row) {
+            if (store->pointCount(row) == 0) {
+                continue;
+            }
+            
+            float weight = 1.0f;
+            if (!heatmapWeightField.isEmpty()) {
+                bool ok = false;
+                weight = static_cast<float>(snapshot[row].attributes.value(heatmapWeightField).toDouble(&ok));
+                if (!ok) {
+                    continue;
+                }
+            }
+            
+            const QPointF center = store->bounds(row).center();
+            points.push_back(needsReprojection() ? transform.transform(center) : center);
+            weights.push_back(weight);
+        }
+        
+        heatmap.setPoints(points, weights);
+        heatmapGeneration = snapshot.generation();
+        heatmapCrs = renderCrs;
+        heatmapPointsValid = true;
+    }
+    
+    // 문자열 필드를 사전 부호화하고 같은 값은 사전의 문자열 하나를 공유하게 함 (스냅샷을 만들기 전에)
+    // 고유값이 많은 자유 텍스트 필드는 부호화하지 않음
+    void encodeDictionaryColumns(std::vector<HGISGdalProvider::Feature> &features) const
+    {
+        dictionaryColumns.clear();
+        if (features.empty() || !provider) {
+            return;
+        }
+        
+        for (const QString &fieldName : provider->fields()) {
+            // 첫 번째 값으로 문자열 필드인지 판단 (숫자 필드는 encode가 거부)
+            auto first = std::find_if(features.begin(), features.end(),
+                                      [&fieldName](const HGISGdalProvider::Feature &f) {
+                                          return !f.attributes.value(fieldName).isNull();
+                                      });
+            if (first == features.end() || first->attributes.value(fieldName).type() != QVariant::String) {
+                continue;
+            }
+            
+            HGISDictionaryColumn column;
+            if (column.encode(features, fieldName)) {
+                dictionaryColumns.insert(fieldName, column);
+            }
+        }
+    }
+    
+    // 데이터 파일 옆의 색인 중 원본이 바뀌지 않은 것만 불러옴
+    void loadAttributeIndexes(const QString &path)
+    {
+        attributeIndexes.clear();
+        
+        for (const QString &fieldName : provider->fields()) {
+            const QString indexPath = HGISAttributeIndex::indexPath(path, fieldName);
+            if (!QFile::exists(indexPath)) {
+                continue;
+            }
+            
+            auto index = std::make_shared<HGISAttributeIndex>();
+            if (index->load(indexPath) && index->fieldName() == fieldName && index->isUpToDate(path)) {
+                attributeIndexes.insert(fieldName, index);
+            } else {
+                qDebug() << "오래되었거나 손상된 속성 색인 무시:" << indexPath;
+            }
+        }
+        
+        if (!attributeIndexes.isEmpty()) {
+            qInfo() << "속성 색인 불러옴:" << attributeIndexes.keys();
+        }
+    }
+    
+    // 색인 없이 필드 값을 순회하며 조건에 맞는 피처 ID 수집
+    QVector<long> scanFeatures(const QString &fieldName, const std::function<bool(const QVariant &)> &match) const
+    {
+        QVector<long> result;
+        
+        if (featuresCached) {
+            for (const HGISGdalProvider::Feature &feature : cachedFeatures) {
+                auto it = feature.attributes.constFind(fieldName);
+                if (it != feature.attributes.constEnd() && match(it.value())) {
+                    result.append(feature.id);
+                }
+            }
+            
+            // 공간 순서로 읽어 두었으면 FID 순서로 돌려 줌
+            if (spatialOrdering) {
+                std::sort(result.begin(), result.end());
+            }
+        } else if (provider && provider->layerHandle()) {
+            OGRFeatureDefnH defn = OGR_L_GetLayerDefn(provider->layerHandle());
+            const int index = OGR_FD_GetFieldIndex(defn, fieldName.toUtf8().constData());
+            if (index < 0) {
+                return result;
+            }
+            const OGRFieldType type = OGR_Fld_GetType(OGR_FD_GetFieldDefn(defn, index));
+            const bool numeric = (type == OFTInteger || type == OFTInteger64 || type == OFTReal);
+            
+            provider->readFeatureBatches(8192, [&](std::vector<OGRFeatureH> &batch) {
+                for (OGRFeatureH feature : batch) {
+                    if (OGR_F_IsFieldSetAndNotNull(feature, index)) {
+                        const QVariant value = numeric
+                            ? QVariant(OGR_F_GetFieldAsDouble(feature, index))
+                            : QVariant(QString::fromUtf8(OGR_F_GetFieldAsString(feature, index)));
+                        if (match(value)) {
+                            result.append(static_cast<long>(OGR_F_GetFID(feature)));
+                        }
+                    }
+                    OGR_F_Destroy(feature);
+                }
+                return true;
+            });
+        }
+        
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+    
+    // 조인 목록으로 가상 열 다시 구성 (원래 필드나 앞선 가상 열과 이름이 겹치면 건너뜀)
+    void rebuildJoinedColumns()
+    {
+        joinedFieldNames.clear();
+        joinedColumns.clear();
+        const QStringList sourceFields = provider ? provider->fields() : QStringList();
+        for (int j = 0; j < joins.size(); ++j) {
+            const QStringList tableFields = joins[j].table->fieldNames();
+            for (int i = 0; i < tableFields.size(); ++i) {
+                const QString name = joins[j].prefix + tableFields[i];
+                if (sourceFields.contains(name) || joinedColumns.contains(name)) {
+                    qWarning() << "이미 있는 필드 이름이라 조인 필드를 건너뜀:" << name;
+                    continue;
+                }
+                joinedFieldNames.append(name);
+                joinedColumns.insert(name, qMakePair(j, i));
+            }
+        }
+    }
+    
+    // 표 경로가 같은 조인 제거 (제거했으면 true)
+    bool eraseJoin(const QString &tablePath)
+    {
+        const int before = joins.size();
+        joins.erase(std::remove_if(joins.begin(), joins.end(), [&tablePath](const LayerJoin &join) {
+            return join.table->tablePath() == tablePath;
+        }), joins.end());
+        return joins.size() != before;
+    }
+    
+    // 정렬/그룹용으로 필요한 필드만 담은 피처 (가상 열 값 포함, 지오메트리 없음)
+    // 캐시가 없으면 요청한 원래 필드와 조인 기준 필드만 OGR에서 읽음 (나머지 필드와 지오메트리는 무시)
+    std::vector<HGISGdalProvider::Feature> joinedRows(const HGISVectorLayer *layer, const QStringList &fieldNames) const
+    {
+        std::vector<HGISGdalProvider::Feature> rows;
+        auto appendRow = [&](long id, const QVariantMap &attributes) {
+            HGISGdalProvider::Feature row;
+            row.id = id;
+            for (const QString &fieldName : fieldNames) {
+                row.attributes.insert(fieldName, joinedColumns.contains(fieldName)
+                                                 ? layer->joinedValue(attributes, fieldName)
+                                                 : attributes.value(fieldName));
+            }
+            rows.push_back(std::move(row));
+        };
+        
+        if (featuresCached) {
+            const HGISFeatureSnapshot snapshot = cachedFeatures;
+            rows.reserve(snapshot.size());
+            for (const HGISGdalProvider::Feature &feature : snapshot) {
+                appendRow(feature.id, feature.attributes);
+            }
+            return rows;
+        }
+        
+        if (!provider || !provider->layerHandle()) {
+            return rows;
+        }
+        
+        // 읽을 원래 필드: 가상 열이 아닌 요청 필드 + 요청한 가상 열이 쓰는 조인 기준 필드
+        QStringList sourceFields;
+        for (const QString &fieldName : fieldNames) {
+            auto it = joinedColumns.constFind(fieldName);
+            const QString name = (it == joinedColumns.constEnd()) ? fieldName : joins[it.value().first].targetField;
+            if (!sourceFields.contains(name)) {
+                sourceFields.append(name);
+            }
+        }
+        
+        OGRLayerH handle = provider->layerHandle();
+        OGRFeatureDefnH defn = OGR_L_GetLayerDefn(handle);
+        std::vector<int> indexes;
+        std::vector<OGRFieldType> types;
+        for (const QString &fieldName : sourceFields) {
+            const int index = OGR_FD_GetFieldIndex(defn, fieldName.toUtf8().constData());
+            indexes.push_back(index);
+            types.push_back(index >= 0 ? OGR_Fld_GetType(OGR_FD_GetFieldDefn(defn, index)) : OFTString);
+        }
+        
+        QList<QByteArray> ignoredNames;
+        for (int i = 0; i < OGR_FD_GetFieldCount(defn); ++i) {
+            if (std::find(indexes.begin(), indexes.end(), i) == indexes.end()) {
+                ignoredNames.append(QByteArray(OGR_Fld_GetNameRef(OGR_FD_GetFieldDefn(defn, i))));
+            }
+        }
+        ignoredNames << "OGR_GEOMETRY" << "OGR_STYLE";
+        std::vector<const char *> ignored;
+        for (const QByteArray &name : ignoredNames) {
+            ignored.push_back(name.constData());
+        }
+        ignored.push_back(nullptr);
+        OGR_L_SetIgnoredFields(handle, ignored.data());
+        
+        rows.reserve(static_cast<std::size_t>(qMax(0L, provider->featureCount())));
+        QVariantMap attributes;
+        provider->readFeatureBatches(8192, [&](std::vector<OGRFeatureH> &batch) {
+            for (OGRFeatureH feature : batch) {
+                // 제공자의 피처 변환과 같은 값 형식 (조인 키 비교가 같도록)
+                attributes.clear();
+                for (std::size_t f = 0; f < indexes.size(); ++f) {
+                    const int index = indexes[f];
+                    if (index < 0 || !OGR_F_IsFieldSet(feature, index)) {
+                        continue;
+                    }
+                    QVariant value;
+                    switch (types[f]) {
+                        case OFTInteger:
+                            value = OGR_F_GetFieldAsInteger(feature, index);
+                            break;
+                        case OFTInteger64:
+                            value = static_cast<qint64>(OGR_F_GetFieldAsInteger64(feature, index));
+                            break;
+                        case OFTReal:
+                            value = OGR_F_GetFieldAsDouble(feature, index);
+                            break;
+                        default:
+                            value = QString::fromUtf8(OGR_F_GetFieldAsString(feature, index));
+                    }
+                    attributes.insert(sourceFields[static_cast<int>(f)], value);
+                }
+                appendRow(static_cast<long>(OGR_F_GetFID(feature)), attributes);
+                OGR_F_Destroy(feature);
+            }
+            return true;
+        });
+        
+        OGR_L_SetIgnoredFields(handle, nullptr);
+        return rows;
+    }
+    
+    static bool isNumber(const QVariant &value)
+    {
+        switch (value.type()) {
+            case QVariant::Int:
+            case QVariant::UInt:
+            case QVariant::LongLong:
+            case QVariant::ULongLong:
+            case QVariant::Double:
+                return true;
+            default:
+                return false;
+        }
+    }
     
     Private()
     {
@@ -59,18 +644,93 @@ public:
             geometryType = HGISGeometryType::Unknown;
         }
     }
+    
+    void updateRenderTransform(const HGISCoordinateReferenceSystem &layerCrs)
+    {
+        if (!renderCrs.isValid() || !layerCrs.isValid()) {
+            renderTransform = HGISCoordinateTransform();
+            inverseRenderTransform = HGISCoordinateTransform();
+            return;
+        }
+        
+        renderTransform = HGISCoordinateTransform(layerCrs, renderCrs);
+        inverseRenderTransform = HGISCoordinateTransform(renderCrs, layerCrs);
+    }
+    
+    bool needsReprojection() const
+    {
+        return renderTransform.isValid() && !renderTransform.isShortCircuitable();
+    }
+    
+    // 렌더링 범위를 레이어 좌표계로 바꾸고 근사 변환 격자 준비
+    QRectF prepareRenderExtent(const QRectF &extent, double scale)
+    {
+        if (!needsReprojection()) {
+            return extent;
+        }
+        
+        // 화면 가장자리 피처가 빠지지 않도록 조밀화된 범위 변환 사용 (결과는 캐시됨)
+        QRectF sourceExtent = inverseRenderTransform.transformBoundingBox(extent);
+        if (sourceExtent.isNull()) {
+            // 화면 범위가 레이어 좌표계 영역을 벗어나면 공간 필터 없이 전체 범위 사용
+            sourceExtent = provider ? provider->extent() : QRectF();
+        }
+        if (scale > 0) {
+            // 화면에서 0.5픽셀 이내 오차로 근사
+            renderTransform.setApproximationExtent(sourceExtent, 0.5 / scale);
+        }
+        return sourceExtent;
+    }
+    
+    void reproject(std::vector<QPointF> &geometry) const
+    {
+        for (QPointF &pt : geometry) {
+            pt = renderTransform.transform(pt);
+        }
+    }
 };
 
 HGISVectorLayer::HGISVectorLayer(const QString &path, const QString &name, const QString &providerKey)
     : HGISMapLayer(HGISMapLayerType::VectorLayer, name.isEmpty() ? QFileInfo(path).baseName() : name, path)
     , d(std::make_unique<Private>())
 {
+    d->textIndex = new HGISTextSearchIndex(this);
+    d->clusterIndex = new HGISPointClusterIndex(this);
+    connect(d->clusterIndex, &HGISPointClusterIndex::ready, this, &HGISMapLayer::repaintRequested);
+    
+    // 메모리 예산을 넘으면 캐시 관리자가 오래 쓰지 않은 레이어의 피처 캐시를 비움
+    d->cacheId = HGISCacheManager::instance()->registerCache(this->name(), [this]() {
+        return d->releaseFeatureCache();
+    });
+    connect(this, &HGISMapLayer::nameChanged, this, [this]() {
+        HGISCacheManager::instance()->setCacheName(d->cacheId, this->name());
+    });
+    
+    connect(this, &HGISMapLayer::crsChanged, this, [this]() {
+        d->updateRenderTransform(crs());
+    });
+    
+    // 보이지 않는 레이어는 읽어 둔 좌표를 압축해 두고, 다시 보여서 그릴 때 풂
+    connect(this, &HGISMapLayer::visibilityChanged, this, [this](bool visible) {
+        if (!visible) {
+            d->compressGeometry(crs());
+        }
+    });
+    connect(this, &HGISMapLayer::dataChanged, this, [this]() {
+        d->statisticsCache.clear();
+        d->summaryCache.clear();
+        d->reportCacheUsage();     // 조인 표 추가/제거, 다시 읽기
+    });
+    
     if (!path.isEmpty()) {
         loadFromFile(path);
     }
 }
 
-HGISVectorLayer::~HGISVectorLayer() = default;
+HGISVectorLayer::~HGISVectorLayer()
+{
+    HGISCacheManager::instance()->unregisterCache(d->cacheId);
+}
 
 bool HGISVectorLayer::loadFromFile(const QString &path)
 {
@@ -94,7 +754,19 @@ bool HGISVectorLayer::loadFromFile(const QString &path)
     d->updateGeometryType();
     
     // 캐시 초기화
-    d->featuresCached = false;
+    d->releaseFeatureCache();
+    d->clusterIndex->clear();
+    
+    // 저장해 둔 속성 색인 불러오기
+    d->loadAttributeIndexes(path);
+    
+    // 조인은 유지하되 새 필드 목록 기준으로 가상 열 이름 다시 확인
+    d->rebuildJoinedColumns();
+    
+    // 이전 데이터로 만든 검색 색인은 새로 생성
+    if (d->textIndex->isReady() || d->textIndex->isBuilding()) {
+        buildTextSearchIndex();
+    }
     
     qInfo() << "벡터 레이어 로드 성공:" << name()
             << "피처 수:" << featureCount()
@@ -149,7 +821,7 @@ QStringList HGISVectorLayer::fields() const
     if (!d->provider) {
         return QStringList();
     }
-    return d->provider->fields();
+    return d->provider->fields() + d->joinedFieldNames;
 }
 
 QRectF HGISVectorLayer::extent() const
@@ -160,15 +832,34 @@ QRectF HGISVectorLayer::extent() const
     return d->provider->extent();
 }
 
-std::vector<HGISGdalProvider::Feature> HGISVectorLayer::features() const
+HGISFeatureSnapshot HGISVectorLayer::features() const
 {
     if (!d->provider) {
-        return std::vector<HGISGdalProvider::Feature>();
+        return HGISFeatureSnapshot();
     }
     
-    if (!d->featuresCached) {
-        d->cachedFeatures = d->provider->readFeatures();
+    if (!d->useCachedFeatures()) {
+        std::vector<HGISGdalProvider::Feature> features = d->provider->readFeatures();
+        
+        // 좌표 저장소와 사전 부호화 열은 정렬한 순서로 만들어 행 위치가 맞게 함 (FID는 featurePositions로 찾음)
+        if (d->spatialOrdering) {
+            sortByHilbert(features);
+        }
+        d->encodeDictionaryColumns(features);
+        
+        // 좌표는 피처별 벡터에서 레이어 좌표 저장소 하나로 옮김 (보이지 않는 레이어는 바로 압축)
+        auto geometryStore = std::make_shared<HGISGeometryStore>();
+        if (isVisible()) {
+            geometryStore->build(features, d->coordinateEncoding, d->coordinateResolution);
+        } else {
+            geometryStore->build(features, HGISCoordinateEncoding::Compressed, d->coldResolution(crs()));
+        }
+        d->cachedFeatures = HGISFeatureSnapshot::fromFeatures(std::move(features), geometryStore);
         d->featuresCached = true;
+        d->reportCacheUsage();
+    } else if (isVisible()) {
+        // 보이지 않는 동안 압축해 둔 좌표를 풂 (보이지 않는 레이어 조회는 압축된 채로 피처별 복원)
+        d->decompressGeometry();
     }
     
     return d->cachedFeatures;
@@ -176,10 +867,40 @@ std::vector<HGISGdalProvider::Feature> HGISVectorLayer::features() const
 
 std::vector<HGISGdalProvider::Feature> HGISVectorLayer::features(const QRectF &extent) const
 {
-    if (!d->provider) {
-        return std::vector<HGISGdalProvider::Feature>();
+    std::vector<HGISGdalProvider::Feature> result;
+    const HGISFeatureSnapshot snapshot = features();
+    const HGISGeometryStore *store = snapshot.geometryStore();
+    if (!store) {
+        return result;
+    }
+    
+    // 피처별 범위로 먼저 걸러 겹치는 피처만 좌표를 복원 (속성은 암시적 공유라 복사하지 않음)
+    const std::vector<std::size_t> rows = store->intersecting(extent);
+    result.reserve(rows.size());
+    for (std::size_t row : rows) {
+        const HGISGdalProvider::Feature &source = snapshot[row];
+        HGISGdalProvider::Feature feature;
+        feature.id = source.id;
+        feature.attributes = source.attributes;
+        feature.geometryType = source.geometryType;
+        store->decode(row, feature.geometry);
+        result.push_back(std::move(feature));
+    }
+    return result;
+}
+
+QVector<long> HGISVectorLayer::featureIdsInExtent(const QRectF &extent) const
+{
+    QVector<long> ids;
+    const HGISFeatureSnapshot snapshot = features();
+    if (const HGISGeometryStore *store = snapshot.geometryStore()) {
+        const std::vector<std::size_t> rows = store->intersecting(extent);
+        ids.reserve(static_cast<int>(rows.size()));
+        for (std::size_t row : rows) {
+            ids.append(snapshot[row].id);
+        }
     }
-    return d->provider->readFeatures(extent);
+    return ids;
 }
 
 HGISSymbol HGISVectorLayer::symbol() const
@@ -205,6 +926,43 @@ void HGISVectorLayer::setRendererType(HGISRendererType type)
     emit repaintRequested();
 }
 
+double HGISVectorLayer::heatmapRadius() const
+{
+    return d->heatmap.radius();
+}
+
+void HGISVectorLayer::setHeatmapRadius(double pixels)
+{
+    d->heatmap.setRadius(pixels);
+    emit repaintRequested();
+}
+
+QString HGISVectorLayer::heatmapWeightField() const
+{
+    return d->heatmapWeightField;
+}
+
+void HGISVectorLayer::setHeatmapWeightField(const QString &fieldName)
+{
+    if (d->heatmapWeightField == fieldName) {
+        return;
+    }
+    d->heatmapWeightField = fieldName;
+    d->heatmapPointsValid = false;
+    emit repaintRequested();
+}
+
+QGradientStops HGISVectorLayer::heatmapColorRamp() const
+{
+    return d->heatmap.colorRamp();
+}
+
+void HGISVectorLayer::setHeatmapColorRamp(const QGradientStops &stops)
+{
+    d->heatmap.setColorRamp(stops);
+    emit repaintRequested();
+}
+
 bool HGISVectorLayer::labelsEnabled() const
 {
     return d->labelsEnabled;
@@ -321,15 +1079,115 @@ void HGISVectorLayer::render(QPainter *painter, const QRectF &extent, double sca
     painter->restore();
 }
 
+HGISCoordinateReferenceSystem HGISVectorLayer::renderCrs() const
+{
+    return d->renderCrs;
+}
+
+void HGISVectorLayer::setRenderCrs(const HGISCoordinateReferenceSystem &crs)
+{
+    if (d->renderCrs == crs) {
+        return;
+    }
+    
+    d->renderCrs = crs;
+    d->updateRenderTransform(this->crs());
+    // 캔버스의 paintEvent 안에서 호출되므로 바로 알리면 그리는 중에 다시 그리기가 예약됨
+    QMetaObject::invokeMethod(this, [this]() {
+        emit repaintRequested();
+    }, Qt::QueuedConnection);
+}
+
 void HGISVectorLayer::renderFeatures(QPainter *painter, const QRectF &extent, double scale)
 {
-    auto featuresToRender = features(extent);
+    QRectF sourceExtent = d->prepareRenderExtent(extent, scale);
+    const HGISFeatureSnapshot snapshot = features();
+    const HGISGeometryStore *store = snapshot.geometryStore();
+    if (!store) {
+        return;
+    }
     
-    for (const auto &feature : featuresToRender) {
-        HGISSymbol symbolToUse = d->symbol;
+    const bool pointLayer = d->geometryType == HGISGeometryType::Point
+                            || d->geometryType == HGISGeometryType::MultiPoint;
+    if (d->rendererType == HGISRendererType::PointCluster && pointLayer
+        && renderClusters(painter, extent, sourceExtent)) {
+        return;
+    }
+    if (d->rendererType == HGISRendererType::Heatmap && pointLayer) {
+        renderHeatmap(painter, snapshot);
+        return;
+    }
+    
+    // 선과 다각형은 화면보다 조금 넓은 범위로 잘라서 그림 (선 굵기, 선택 표시 굵기만큼 여유)
+    // 선 굵기는 픽셀 단위이므로 페인터 변환의 축척으로 지도 단위로 바꿔 더함
+    const QTransform toDevice = painter->combinedTransform();
+    const double renderPixelsPerUnit = extent.width() > 0.0
+        ? toDevice.mapRect(extent).width() / extent.width() : 0.0;
+    double clipMargin = std::max(extent.width(), extent.height()) * kClipMarginRatio;
+    if (renderPixelsPerUnit > 0.0) {
+        clipMargin += 2.0 * std::max(d->symbol.strokeWidth, 2.0) / renderPixelsPerUnit;
+    }
+    const QRectF clipExtent = extent.normalized().adjusted(-clipMargin, -clipMargin, clipMargin, clipMargin);
+    QVector<QPointF> clippedPolygon;
+    QVector<QVector<QPointF>> clippedLines;
+    
+    // 범위가 한 픽셀보다 작은 피처는 화면 픽셀 하나로 모음 (이미 그린 픽셀이면 건너뜀)
+    // 축소한 전국 목록처럼 피처가 픽셀보다 많아도 그리는 양은 화면 픽셀 수를 넘지 않음
+    const QRect deviceRect = painter->device()
+        ? QRect(0, 0, painter->device()->width(), painter->device()->height()) : QRect();
+    const double pixelsPerUnit = sourceExtent.width() > 0.0
+        ? toDevice.mapRect(extent).width() / sourceExtent.width() : 0.0;
+    d->resetOccupiedPixels(deviceRect.size());
+    QVector<QPoint> pixels;
+    
+    // 지점이 차지하는 장치 픽셀을 표시, 이미 다른 피처가 차지했거나 화면 밖이면 false (그리지 않음)
+    auto claimPixel = [&](QPointF point, QPoint &pixel) {
+        if (d->needsReprojection()) {
+            point = d->renderTransform.transform(point);
+        }
+        pixel = toDevice.map(point).toPoint();
+        if (!deviceRect.contains(pixel)) {
+            return false;
+        }
+        const std::size_t index = static_cast<std::size_t>(pixel.y()) * deviceRect.width() + pixel.x();
+        if (d->occupiedPixels[index]) {
+            return false;
+        }
+        d->occupiedPixels[index] = true;
+        d->claimedPixels.push_back(index);
+        return true;
+    };
+    
+    std::vector<QPointF> geometry;
+    for (std::size_t row : store->intersecting(sourceExtent)) {
+        const long featureId = snapshot[row].id;
+        const bool selected = isFeatureSelected(featureId);
+        
+        // 선택된 피처는 모으지 않고 항상 그림
+        const QRectF box = store->bounds(row);
+        if (!selected && pixelsPerUnit > 0.0
+            && box.width() * pixelsPerUnit < kSubPixelSize && box.height() * pixelsPerUnit < kSubPixelSize) {
+            QPoint pixel;
+            if (!claimPixel(box.center(), pixel)) {
+                continue;
+            }
+            // 점 심볼은 픽셀마다 한 번 그리고, 선/다각형은 픽셀 하나만 찍음
+            if (!pointLayer) {
+                pixels.append(pixel);
+                continue;
+            }
+        }
+        
+        geometry.clear();
+        store->decode(row, geometry);
+        if (d->needsReprojection()) {
+            d->reproject(geometry);
+        }
+        
+        HGISSymbol symbolToUse = d->symbol;
         
         // 선택된 피처는 다른 색상으로
-        if (isFeatureSelected(feature.id)) {
+        if (selected) {
             symbolToUse.fillColor = QColor(255, 255, 0, 150);
             symbolToUse.strokeColor = Qt::yellow;
             symbolToUse.strokeWidth = 2.0;
@@ -339,29 +1197,119 @@ void HGISVectorLayer::renderFeatures(QPainter *painter, const QRectF &extent, do
         switch (d->geometryType) {
             case HGISGeometryType::Point:
             case HGISGeometryType::MultiPoint:
-                for (const auto &pt : feature.geometry) {
+                for (const auto &pt : geometry) {
                     drawPointSymbol(painter, pt, symbolToUse);
                 }
                 break;
-                
+            
             case HGISGeometryType::LineString:
-            case HGISGeometryType::MultiLineString: {
-                QVector<QPointF> linePoints(feature.geometry.begin(), feature.geometry.end());
-                drawLineSymbol(painter, linePoints, symbolToUse);
+            case HGISGeometryType::MultiLineString:
+                HGISGeometryClipper::clipPolyline(geometry, clipExtent, clippedLines);
+                for (const QVector<QPointF> &linePoints : clippedLines) {
+                    drawLineSymbol(painter, linePoints, symbolToUse);
+                }
                 break;
-            }
-                
+            
             case HGISGeometryType::Polygon:
-            case HGISGeometryType::MultiPolygon: {
-                QVector<QPointF> polyPoints(feature.geometry.begin(), feature.geometry.end());
-                drawPolygonSymbol(painter, polyPoints, symbolToUse);
+            case HGISGeometryType::MultiPolygon:
+                HGISGeometryClipper::clipPolygon(geometry, clipExtent, clippedPolygon);
+                drawPolygonSymbol(painter, clippedPolygon, symbolToUse);
                 break;
-            }
-                
+            
             default:
                 break;
         }
     }
+    
+    // 모은 픽셀은 장치 좌표로 한 번에 찍음
+    if (!pixels.isEmpty()) {
+        painter->save();
+        painter->resetTransform();
+        painter->setRenderHint(QPainter::Antialiasing, false);
+        painter->setPen(QPen(d->symbol.strokeColor, 1.0));
+        painter->drawPoints(pixels.constData(), pixels.size());
+        painter->restore();
+    }
+}
+
+bool HGISVectorLayer::renderClusters(QPainter *painter, const QRectF &extent, const QRectF &sourceExtent)
+{
+    // 계층이 준비될 때까지는 개별 점으로 그림 (준비되면 ready로 다시 그림)
+    if (!d->clusterIndex->isReady()) {
+        if (!d->clusterIndex->isBuilding()) {
+            d->clusterIndex->buildInBackground(features());
+        }
+        return false;
+    }
+    
+    // 화면 반경을 레이어 단위로 바꿔 단계 선택 (가장 작은 단계보다 확대했으면 개별 점)
+    const QTransform toDevice = painter->combinedTransform();
+    const double deviceWidth = toDevice.mapRect(extent).width();
+    if (deviceWidth <= 0.0 || sourceExtent.width() <= 0.0) {
+        return false;
+    }
+    const int level = d->clusterIndex->levelForRadius(kClusterRadiusPixels * sourceExtent.width() / deviceWidth);
+    if (level < 0) {
+        return false;
+    }
+    
+    const QVector<HGISPointCluster> clusters = d->clusterIndex->clusters(level, sourceExtent);
+    QVector<HGISPointCluster> singles;
+    
+    // 군집 표시는 장치 좌표로 그려 축척과 관계없이 같은 크기
+    painter->save();
+    painter->resetTransform();
+    painter->setFont(d->labelFont);
+    for (const HGISPointCluster &cluster : clusters) {
+        if (cluster.count == 1) {
+            singles.append(cluster);
+            continue;
+        }
+        
+        const QPointF center = toDevice.map(d->needsReprojection() ? d->renderTransform.transform(cluster.center)
+                                                                   : cluster.center);
+        const double radius = 10.0 + 4.0 * std::log10(static_cast<double>(cluster.count));
+        QColor fill = d->symbol.fillColor;
+        fill.setAlpha(200);
+        painter->setPen(QPen(d->symbol.strokeColor, 1.5));
+        painter->setBrush(fill);
+        painter->drawEllipse(center, radius, radius);
+        
+        painter->setPen(d->labelColor);
+        painter->drawText(QRectF(center.x() - radius, center.y() - radius, radius * 2, radius * 2),
+                          Qt::AlignCenter, QString::number(cluster.count));
+    }
+    painter->restore();
+    
+    // 묶이지 않은 점은 원래 심볼로
+    for (const HGISPointCluster &single : singles) {
+        HGISSymbol symbolToUse = d->symbol;
+        if (isFeatureSelected(single.featureId)) {
+            symbolToUse.fillColor = QColor(255, 255, 0, 150);
+            symbolToUse.strokeColor = Qt::yellow;
+            symbolToUse.strokeWidth = 2.0;
+        }
+        drawPointSymbol(painter, d->needsReprojection() ? d->renderTransform.transform(single.center) : single.center,
+                        symbolToUse);
+    }
+    return true;
+}
+
+void HGISVectorLayer::renderHeatmap(QPainter *painter, const HGISFeatureSnapshot &snapshot)
+{
+    if (!painter->device()) {
+        return;
+    }
+    
+    // 밀도 이미지는 장치 픽셀 단위 (끌어서 이동하면 새로 드러난 띠만 다시 계산)
+    d->prepareHeatmapPoints(snapshot);
+    const QSize size(painter->device()->width(), painter->device()->height());
+    const QImage image = d->heatmap.render(painter->combinedTransform(), size);
+    
+    painter->save();
+    painter->resetTransform();
+    painter->drawImage(QPointF(0, 0), image);
+    painter->restore();
 }
 
 void HGISVectorLayer::renderLabels(QPainter *painter, const QRectF &extent, double scale)
@@ -373,13 +1321,18 @@ void HGISVectorLayer::renderLabels(QPainter *painter, const QRectF &extent, doub
     painter->setFont(d->labelFont);
     painter->setPen(d->labelColor);
     
-    auto featuresToLabel = features(extent);
+    QRectF sourceExtent = d->prepareRenderExtent(extent, scale);
+    auto featuresToLabel = features(sourceExtent);
     
-    for (const auto &feature : featuresToLabel) {
+    for (auto &feature : featuresToLabel) {
         if (feature.geometry.empty()) {
             continue;
         }
         
+        if (d->needsReprojection()) {
+            d->reproject(feature.geometry);
+        }
+        
         // 라벨 텍스트 가져오기
         QVariant labelValue = feature.attributes.value(d->labelField);
         QString labelText = labelValue.toString();
@@ -420,12 +1373,12 @@ void HGISVectorLayer::drawPointSymbol(QPainter *painter, const QPointF &point, c
         case HGISSymbol::Circle:
             painter->drawEllipse(point, size, size);
             break;
-            
+        
         case HGISSymbol::Square:
             painter->drawRect(QRectF(point.x() - size, point.y() - size, 
                                     size * 2, size * 2));
             break;
-            
+        
         case HGISSymbol::Triangle: {
             QPolygonF triangle;
             triangle << QPointF(point.x(), point.y() - size)
@@ -434,14 +1387,14 @@ void HGISVectorLayer::drawPointSymbol(QPainter *painter, const QPointF &point, c
             painter->drawPolygon(triangle);
             break;
         }
-            
+        
         case HGISSymbol::Cross:
             painter->drawLine(QPointF(point.x() - size, point.y()), 
                             QPointF(point.x() + size, point.y()));
             painter->drawLine(QPointF(point.x(), point.y() - size), 
                             QPointF(point.x(), point.y() + size));
             break;
-            
+        
         case HGISSymbol::Star: {
             QPolygonF star;
             for (int i = 0; i < 10; i++) {
@@ -500,6 +1453,12 @@ HGISMapLayer* HGISVectorLayer::clone() const
     layer->setLabelField(d->labelField);
     layer->setLabelFont(d->labelFont);
     layer->setLabelColor(d->labelColor);
+    layer->setRenderCrs(d->renderCrs);
+    layer->setCoordinateEncoding(d->coordinateEncoding, d->coordinateResolution);
+    layer->setSpatialOrdering(d->spatialOrdering);
+    layer->setHeatmapRadius(d->heatmap.radius());
+    layer->setHeatmapWeightField(d->heatmapWeightField);
+    layer->setHeatmapColorRamp(d->heatmap.colorRamp());
     
     if (!source().isEmpty()) {
         layer->loadFromFile(source());
@@ -511,4 +1470,550 @@ HGISMapLayer* HGISVectorLayer::clone() const
 bool HGISVectorLayer::isValid() const
 {
     return HGISMapLayer::isValid() && d->provider && d->provider->isValid();
-}
\ No newline at end of file
+}
+
+QVector<long> HGISVectorLayer::featureIds() const
+{
+    const HGISFeatureSnapshot snapshot = features();
+    QVector<long> ids;
+    ids.reserve(static_cast<int>(snapshot.size()));
+    for (const HGISGdalProvider::Feature &feature : snapshot) {
+        ids.append(feature.id);
+    }
+    return ids;
+}
+
+QStringList HGISVectorLayer::dictionaryEncodedFields() const
+{
+    features();
+    QStringList fieldNames = d->dictionaryColumns.keys();
+    fieldNames.sort();
+    return fieldNames;
+}
+
+HGISDictionaryColumn HGISVectorLayer::dictionaryColumn(const QString &fieldName) const
+{
+    features();
+    return d->dictionaryColumns.value(fieldName);
+}
+
+HGISCoordinateEncoding HGISVectorLayer::coordinateEncoding() const
+{
+    return d->coordinateEncoding;
+}
+
+double HGISVectorLayer::coordinateResolution() const
+{
+    return d->coordinateResolution;
+}
+
+void HGISVectorLayer::setCoordinateEncoding(HGISCoordinateEncoding encoding, double resolution)
+{
+    if (d->coordinateEncoding == encoding && qFuzzyCompare(d->coordinateResolution, resolution)) {
+        return;
+    }
+    d->coordinateEncoding = encoding;
+    d->coordinateResolution = resolution;
+    
+    // 다음에 읽을 때 새 방식으로 저장
+    releaseFeatureCache();
+    emit repaintRequested();
+}
+
+bool HGISVectorLayer::spatialOrdering() const
+{
+    return d->spatialOrdering;
+}
+
+void HGISVectorLayer::setSpatialOrdering(bool enabled)
+{
+    if (d->spatialOrdering == enabled) {
+        return;
+    }
+    d->spatialOrdering = enabled;
+    
+    // 다음에 읽을 때 새 순서로 배열
+    releaseFeatureCache();
+}
+
+HGISCacheUsage HGISVectorLayer::memoryUsage() const
+{
+    return d->cacheUsage();
+}
+
+void HGISVectorLayer::releaseFeatureCache()
+{
+    if (d->featuresCached) {
+        HGISCacheManager::instance()->updateUsage(d->cacheId, d->releaseFeatureCache());
+    }
+}
+
+HGISFieldStatistics HGISVectorLayer::statistics(const QString &fieldName) const
+{
+    return statistics(QStringList{fieldName}).value(0);
+}
+
+QVector<HGISFieldStatistics> HGISVectorLayer::statistics(const QStringList &fieldNames) const
+{
+    QStringList missing;
+    for (const QString &fieldName : fieldNames) {
+        if (!d->statisticsCache.contains(fieldName) && !missing.contains(fieldName)) {
+            missing.append(fieldName);
+        }
+    }
+    
+    if (!missing.isEmpty() && d->provider) {
+        // 고유값 목록은 uniqueValues()용으로 상한(maxUniqueValues) 안에서만 수집
+        HGISStatisticsEngine::Options options;
+        options.collectUniqueValues = true;
+        
+        // 피처를 이미 읽어 두었으면 메모리에서, 아니면 제공자에서 스트리밍
+        QVector<HGISFieldStatistics> computed = d->useCachedFeatures()
+            ? HGISStatisticsEngine::calculate(d->cachedFeatures.features(), missing, options)
+            : HGISStatisticsEngine::calculate(*d->provider, missing, options);
+        
+        for (const HGISFieldStatistics &stats : computed) {
+            d->statisticsCache.insert(stats.fieldName, stats);
+        }
+    }
+    
+    QVector<HGISFieldStatistics> result;
+    result.reserve(fieldNames.size());
+    for (const QString &fieldName : fieldNames) {
+        HGISFieldStatistics stats = d->statisticsCache.value(fieldName);
+        stats.fieldName = fieldName;
+        result.append(stats);
+    }
+    return result;
+}
+
+double HGISVectorLayer::minimumValue(const QString &fieldName) const
+{
+    return statistics(fieldName).minimum;
+}
+
+double HGISVectorLayer::maximumValue(const QString &fieldName) const
+{
+    return statistics(fieldName).maximum;
+}
+
+QVariant HGISVectorLayer::uniqueValues(const QString &fieldName) const
+{
+    return statistics(fieldName).uniqueValues;
+}
+
+HGISFieldStatistics HGISVectorLayer::fieldSummary(const QString &fieldName) const
+{
+    // 전체 통계가 이미 있으면 그대로 사용
+    auto it = d->statisticsCache.constFind(fieldName);
+    if (it != d->statisticsCache.constEnd()) {
+        return it.value();
+    }
+    
+    it = d->summaryCache.constFind(fieldName);
+    if (it != d->summaryCache.constEnd()) {
+        return it.value();
+    }
+    
+    HGISFieldStatistics summary;
+    summary.fieldName = fieldName;
+    if (d->provider) {
+        HGISStatisticsEngine::Options options;
+        options.collectUniqueValues = false;
+        options.histogramBins = 0;
+        
+        QVector<HGISFieldStatistics> computed = d->useCachedFeatures()
+            ? HGISStatisticsEngine::calculate(d->cachedFeatures.features(), QStringList{fieldName}, options)
+            : HGISStatisticsEngine::calculate(*d->provider, QStringList{fieldName}, options);
+        if (!computed.isEmpty()) {
+            summary = computed.first();
+        }
+    }
+    
+    d->summaryCache.insert(fieldName, summary);
+    return summary;
+}
+
+double HGISVectorLayer::approximateDistinctCount(const QString &fieldName) const
+{
+    return fieldSummary(fieldName).approximateDistinctCount();
+}
+
+bool HGISVectorLayer::isCategorizable(const QString &fieldName, int maxCategories) const
+{
+    // 요약이 이미 있으면 바로 판단
+    if (d->statisticsCache.contains(fieldName) || d->summaryCache.contains(fieldName)) {
+        return fieldSummary(fieldName).isCategorizable(maxCategories);
+    }
+    
+    // 앞쪽 표본에서 이미 초과하면 전체를 읽을 필요 없음
+    constexpr long kSampleSize = 65536;
+    if (d->provider && featureCount() > kSampleSize) {
+        HGISStatisticsEngine::Options options;
+        options.collectUniqueValues = false;
+        options.histogramBins = 0;
+        options.topK = 0;
+        options.maxFeatures = kSampleSize;
+        
+        QVector<HGISFieldStatistics> sample = d->useCachedFeatures()
+            ? HGISStatisticsEngine::calculate(d->cachedFeatures.features(), QStringList{fieldName}, options)
+            : HGISStatisticsEngine::calculate(*d->provider, QStringList{fieldName}, options);
+        if (!sample.isEmpty() && sample.first().approximateDistinctCount() > maxCategories) {
+            return false;
+        }
+    }
+    
+    return fieldSummary(fieldName).isCategorizable(maxCategories);
+}
+
+QVariantList HGISVectorLayer::categoryValues(const QString &fieldName, int maxCategories) const
+{
+    QVariantList values;
+    for (const HGISValueCount &entry : fieldSummary(fieldName).topValues(maxCategories)) {
+        values.append(entry.value);
+    }
+    return values;
+}
+
+QVariant HGISVectorLayer::attributeValue(long featureId, const QString &fieldName) const
+{
+    return attributes(featureId).value(fieldName);
+}
+
+QMap<QString, QVariant> HGISVectorLayer::attributes(long featureId) const
+{
+    QMap<QString, QVariant> result;
+    if (d->featuresCached) {
+        const HGISGdalProvider::Feature *feature = d->cachedFeature(featureId);
+        if (feature) {
+            result = feature->attributes;
+        }
+    } else {
+        HGISGdalProvider::Feature feature;
+        if (d->provider && d->provider->readFeature(featureId, feature)) {
+            result = feature.attributes;
+        }
+    }
+    
+    if (!result.isEmpty()) {
+        for (const QString &fieldName : d->joinedFieldNames) {
+            const QVariant value = joinedValue(result, fieldName);
+            if (value.isValid()) {
+                result.insert(fieldName, value);
+            }
+        }
+    }
+    return result;
+}
+
+bool HGISVectorLayer::addJoin(const QString &targetField, const QString &tablePath, const QString &joinField,
+                              const QStringList &fieldNames, const QString &prefix)
+{
+    if (!d->provider || !d->provider->fields().contains(targetField)) {
+        qWarning() << "조인 대상 필드를 찾을 수 없습니다:" << targetField;
+        return false;
+    }
+    
+    auto table = std::make_shared<HGISAttributeJoin>();
+    if (!table->load(tablePath, joinField, fieldNames)) {
+        return false;
+    }
+    
+    // 같은 표를 다시 조인하면 교체
+    d->eraseJoin(tablePath);
+    
+    Private::LayerJoin join;
+    join.targetField = targetField;
+    join.prefix = prefix;
+    join.table = table;
+    d->joins.append(join);
+    d->rebuildJoinedColumns();
+    
+    qInfo() << "속성 조인:" << name() << targetField << "<-" << QFileInfo(tablePath).fileName()
+            << joinField << "가상 필드:" << d->joinedFieldNames;
+    emit dataChanged();
+    return true;
+}
+
+void HGISVectorLayer::removeJoin(const QString &tablePath)
+{
+    if (d->eraseJoin(tablePath)) {
+        d->rebuildJoinedColumns();
+        emit dataChanged();
+    }
+}
+
+void HGISVectorLayer::removeAllJoins()
+{
+    if (d->joins.isEmpty()) {
+        return;
+    }
+    d->joins.clear();
+    d->rebuildJoinedColumns();
+    emit dataChanged();
+}
+
+QStringList HGISVectorLayer::joinedFields() const
+{
+    return d->joinedFieldNames;
+}
+
+bool HGISVectorLayer::isJoinedField(const QString &fieldName) const
+{
+    return d->joinedColumns.contains(fieldName);
+}
+
+QVariant HGISVectorLayer::joinedValue(const QVariantMap &attributes, const QString &fieldName) const
+{
+    auto it = d->joinedColumns.constFind(fieldName);
+    if (it == d->joinedColumns.constEnd()) {
+        return QVariant();
+    }
+    const Private::LayerJoin &join = d->joins[it.value().first];
+    const int row = join.table->findRow(attributes.value(join.targetField));
+    return join.table->value(row, it.value().second);
+}
+
+bool HGISVectorLayer::createAttributeIndex(const QString &fieldName, HGISAttributeIndex::Type type)
+{
+    if (!d->provider) {
+        return false;
+    }
+    
+    auto existing = d->attributeIndexes.value(fieldName);
+    if (existing && existing->type() == type && existing->isUpToDate(source())) {
+        return true;
+    }
+    
+    auto index = std::make_shared<HGISAttributeIndex>();
+    if (!index->build(*d->provider, fieldName, type)) {
+        qWarning() << "속성 색인 생성 실패:" << fieldName << index->errorMessage();
+        return false;
+    }
+    
+    // 저장에 실패해도 (읽기 전용 위치 등) 메모리 색인은 사용
+    const QString indexPath = HGISAttributeIndex::indexPath(source(), fieldName);
+    if (!index->save(indexPath)) {
+        qWarning() << "속성 색인 저장 실패:" << indexPath << index->errorMessage();
+    }
+    
+    d->attributeIndexes.insert(fieldName, index);
+    d->reportCacheUsage();
+    return true;
+}
+
+void HGISVectorLayer::removeAttributeIndex(const QString &fieldName)
+{
+    if (d->attributeIndexes.remove(fieldName) > 0) {
+        QFile::remove(HGISAttributeIndex::indexPath(source(), fieldName));
+        d->reportCacheUsage();
+    }
+}
+
+bool HGISVectorLayer::hasAttributeIndex(const QString &fieldName) const
+{
+    return d->attributeIndexes.contains(fieldName);
+}
+
+QStringList HGISVectorLayer::indexedFields() const
+{
+    return d->attributeIndexes.keys();
+}
+
+QVector<long> HGISVectorLayer::findFeatures(const QString &fieldName, const QVariant &value) const
+{
+    if (value.isNull()) {
+        return QVector<long>();
+    }
+    
+    auto index = d->attributeIndexes.value(fieldName);
+    if (index) {
+        return index->find(value);
+    }
+    
+    // 사전 부호화한 열은 코드 정수 비교
+    if (d->useCachedFeatures() && d->dictionaryColumns.contains(fieldName)) {
+        const HGISDictionaryColumn column = d->dictionaryColumns.value(fieldName);
+        QVector<long> result;
+        for (long row : column.findRows(column.codeOf(value.toString()))) {
+            result.append(d->cachedFeatures[static_cast<std::size_t>(row)].id);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+    
+    const bool numeric = Private::isNumber(value);
+    const double number = value.toDouble();
+    const QString text = value.toString();
+    return d->scanFeatures(fieldName, [&](const QVariant &candidate) {
+        return numeric && Private::isNumber(candidate) ? candidate.toDouble() == number
+                                                      : candidate.toString() == text;
+    });
+}
+
+QVector<long> HGISVectorLayer::findFeaturesInRange(const QString &fieldName,
+                                                   const QVariant &minimum, const QVariant &maximum) const
+{
+    auto index = d->attributeIndexes.value(fieldName);
+    if (index && index->type() == HGISAttributeIndex::SortedIndex) {
+        return index->findRange(minimum, maximum);
+    }
+    
+    // 경계가 숫자면 숫자 순서, 아니면 사전순 비교
+    const bool numeric = (!minimum.isValid() || Private::isNumber(minimum))
+                         && (!maximum.isValid() || Private::isNumber(maximum));
+    return d->scanFeatures(fieldName, [&](const QVariant &candidate) {
+        if (numeric && Private::isNumber(candidate)) {
+            const double value = candidate.toDouble();
+            return (!minimum.isValid() || value >= minimum.toDouble())
+                   && (!maximum.isValid() || value <= maximum.toDouble());
+        }
+        const QString value = candidate.toString();
+        return (!minimum.isValid() || value >= minimum.toString())
+               && (!maximum.isValid() || value <= maximum.toString());
+    });
+}
+
+QVector<long> HGISVectorLayer::sortedFeatureIds(const QString &fieldName, bool descending) const
+{
+    // 문자열 색인은 코드 단위 순서라 한국어 정렬 규칙과 다르므로 숫자 색인만 사용
+    auto index = d->attributeIndexes.value(fieldName);
+    if (index && index->isNumeric()) {
+        return index->orderedFeatureIds(descending);
+    }
+    
+    HGISSortKey key;
+    key.fieldName = fieldName;
+    key.descending = descending;
+    return sortFeatureIds(QVector<HGISSortKey>{key});
+}
+
+QVector<long> HGISVectorLayer::sortFeatureIds(const QVector<HGISSortKey> &keys) const
+{
+    // 가상 열은 제공자에 없으므로 필요한 필드만 담은 피처를 만들어 정렬
+    QStringList keyFields;
+    bool joined = false;
+    for (const HGISSortKey &key : keys) {
+        keyFields << key.fieldName;
+        joined = joined || isJoinedField(key.fieldName);
+    }
+    if (joined) {
+        return HGISSortEngine::sortFeatureIds(d->joinedRows(this, keyFields), keys);
+    }
+    
+    if (d->useCachedFeatures()) {
+        return HGISSortEngine::sortFeatureIds(d->cachedFeatures.features(), keys);
+    }
+    if (d->provider) {
+        return HGISSortEngine::sortFeatureIds(*d->provider, keys);
+    }
+    return QVector<long>();
+}
+
+QVector<HGISGroup> HGISVectorLayer::groupBy(const QStringList &groupFields,
+                                            const QStringList &aggregateFields) const
+{
+    const QStringList allFields = groupFields + aggregateFields;
+    if (std::any_of(allFields.begin(), allFields.end(),
+                    [this](const QString &fieldName) { return isJoinedField(fieldName); })) {
+        return HGISSortEngine::groupBy(d->joinedRows(this, allFields), groupFields, aggregateFields);
+    }
+    
+    if (d->useCachedFeatures()) {
+        return HGISSortEngine::groupBy(d->cachedFeatures.features(), groupFields, aggregateFields);
+    }
+    if (d->provider) {
+        return HGISSortEngine::groupBy(*d->provider, groupFields, aggregateFields);
+    }
+    return QVector<HGISGroup>();
+}
+
+void HGISVectorLayer::setTextSearchFields(const QStringList &fieldNames)
+{
+    if (d->textSearchFields == fieldNames) {
+        return;
+    }
+    d->textSearchFields = fieldNames;
+    
+    if (d->textIndex->isReady() || d->textIndex->isBuilding()) {
+        buildTextSearchIndex();
+    }
+}
+
+QStringList HGISVectorLayer::textSearchFields() const
+{
+    return d->textSearchFields;
+}
+
+void HGISVectorLayer::buildTextSearchIndex()
+{
+    if (!d->provider || !d->provider->isValid()) {
+        return;
+    }
+    d->textIndex->buildInBackground(source(), d->textSearchFields);
+}
+
+HGISTextSearchIndex* HGISVectorLayer::textSearchIndex() const
+{
+    return d->textIndex;
+}
+
+HGISPointClusterIndex* HGISVectorLayer::pointClusterIndex() const
+{
+    return d->clusterIndex;
+}
+
+QVector<long> HGISVectorLayer::searchText(const QString &query, int limit) const
+{
+    if (!d->textIndex->isReady()) {
+        if (!d->textIndex->isBuilding() && d->provider && d->provider->isValid()) {
+            d->textIndex->buildInBackground(source(), d->textSearchFields);
+        }
+        return QVector<long>();
+    }
+    return d->textIndex->search(query, limit);
+}
+
+QRectF HGISVectorLayer::featuresExtent(const QVector<long> &featureIds) const
+{
+    double minX = std::numeric_limits<double>::max();
+    double minY = std::numeric_limits<double>::max();
+    double maxX = -std::numeric_limits<double>::max();
+    double maxY = -std::numeric_limits<double>::max();
+    
+    auto includeBox = [&](const QRectF &box) {
+        minX = std::min(minX, box.left());
+        minY = std::min(minY, box.top());
+        maxX = std::max(maxX, box.right());
+        maxY = std::max(maxY, box.bottom());
+    };
+    auto include = [&](const HGISGdalProvider::Feature &feature) {
+        for (const QPointF &point : feature.geometry) {
+            minX = std::min(minX, point.x());
+            minY = std::min(minY, point.y());
+            maxX = std::max(maxX, point.x());
+            maxY = std::max(maxY, point.y());
+        }
+    };
+    
+    for (long featureId : featureIds) {
+        const HGISGeometryStore *store = d->featuresCached ? d->cachedFeatures.geometryStore() : nullptr;
+        if (store) {
+            // 읽어 둔 피처는 저장해 둔 범위 사용 (좌표 복원 없음)
+            const long row = d->cachedRow(featureId);
+            if (row >= 0 && store->pointCount(static_cast<std::size_t>(row)) > 0) {
+                includeBox(store->bounds(static_cast<std::size_t>(row)));
+            }
+        } else if (d->provider) {
+            HGISGdalProvider::Feature feature;
+            if (d->provider->readFeature(featureId, feature)) {
+                include(feature);
+            }
+        }
+    }
+    
+    if (minX > maxX) {
+        return QRectF();
+    }
+    return QRectF(QPointF(minX, minY), QPointF(maxX, maxY));
+}
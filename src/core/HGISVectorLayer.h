@@ -2,6 +2,16 @@
 #define HGISVECTORLAYER_H
 
 #include "HGISMapLayer.h"
+#include "HGISAttributeIndex.h"
+#include "HGISAttributeJoin.h"
+#include "HGISCacheManager.h"
+#include "HGISDictionaryColumn.h"
+#include "HGISFeatureSnapshot.h"
+#include "HGISHeatmapRenderer.h"
+#include "HGISPointClusterIndex.h"
+#include "HGISTextSearchIndex.h"
+#include "HGISStatisticsEngine.h"
+#include "HGISSortEngine.h"
 #include "providers/HGISGdalProvider.h"
 #include <QColor>
 #include <memory>
@@ -28,7 +38,9 @@ enum class HGISRendererType
     SingleSymbol,      // 단일 심볼
     Categorized,       // 분류 심볼
     Graduated,         // 단계 심볼
-    RuleBased         // 규칙 기반
+    RuleBased,        // 규칙 기반
+    PointCluster,     // 점 군집 (축척에 따라 묶어 개수 표시, 확대하면 개별 점)
+    Heatmap           // 점 밀도 열 지도
 };
 
 // 심볼 설정
@@ -55,7 +67,7 @@ struct HGISSymbol
 class CORE_EXPORT HGISVectorLayer : public HGISMapLayer
 {
     Q_OBJECT
-
+    
 public:
     // 생성자
     explicit HGISVectorLayer(const QString &path = QString(),
@@ -76,16 +88,33 @@ public:
     // 피처 수
     long featureCount() const;
     
-    // 필드 정보
+    // 필드 정보 (조인한 가상 열 포함)
     QStringList fields() const;
     
     // 범위
     QRectF extent() const override;
     
     // 피처 가져오기
-    std::vector<HGISGdalProvider::Feature> features() const;
+    // 전체 피처는 메모리에 한 번 읽어 두고 복사 없이 공유 스냅샷으로 반환
+    // (메모리 예산을 넘으면 캐시 관리자가 비울 수 있으나, 받은 스냅샷은 계속 유효)
+    // 좌표는 레이어 좌표 저장소에 있으므로 snapshot.geometry(i)로 읽음
+    HGISFeatureSnapshot features() const;
+    
+    // features() 순서의 피처 ID (사전 부호화 열의 행 순서와 같음)
+    QVector<long> featureIds() const;
+    
+    // 사전 부호화 열 (피처를 읽을 때 값 종류가 적은 문자열 필드를 자동으로 부호화)
+    // 부호화한 필드는 같은 값 검색을 코드 비교로 처리하고, 피처들은 사전의 문자열을 공유
+    QStringList dictionaryEncodedFields() const;
+    HGISDictionaryColumn dictionaryColumn(const QString &fieldName) const;
+    
+    // 범위와 겹치는 피처 (좌표를 복원해 geometry에 담음, 렌더링용)
+    // 피처별 범위로 먼저 거르므로 범위 밖 피처는 좌표를 읽지 않음
     std::vector<HGISGdalProvider::Feature> features(const QRectF &extent) const;
     
+    // 범위가 extent와 겹치는 피처 ID (영역 선택, 식별 - 크기 0인 범위는 점 질의)
+    QVector<long> featureIdsInExtent(const QRectF &extent) const;
+    
     // 심볼 설정
     HGISSymbol symbol() const;
     void setSymbol(const HGISSymbol &symbol);
@@ -94,6 +123,15 @@ public:
     HGISRendererType rendererType() const;
     void setRendererType(HGISRendererType type);
     
+    // 열 지도 설정 (Heatmap 렌더러)
+    // 반경은 화면 픽셀, 가중치 필드가 비어 있으면 점마다 1 (숫자가 아닌 값은 제외)
+    double heatmapRadius() const;
+    void setHeatmapRadius(double pixels);
+    QString heatmapWeightField() const;
+    void setHeatmapWeightField(const QString &fieldName);
+    QGradientStops heatmapColorRamp() const;
+    void setHeatmapColorRamp(const QGradientStops &stops);
+    
     // 라벨 설정
     bool labelsEnabled() const;
     void setLabelsEnabled(bool enabled);
@@ -112,23 +150,114 @@ public:
     void clearSelection();
     bool isFeatureSelected(long id) const;
     
-    // 속성 테이블
+    // 속성 테이블 (피처를 읽어 두었으면 메모리에서, 아니면 FID로 제공자에서 직접 읽음)
     QVariant attributeValue(long featureId, const QString &fieldName) const;
     QMap<QString, QVariant> attributes(long featureId) const;
     
+    // 외부 표 조인 (CSV/XLSX 등)
+    // 표를 한 번 읽어 조인 키 해시를 만들고, 표 필드는 prefix를 붙인 가상 열로 fields()에 추가
+    // 대상 피처는 복사하지 않고 값을 조회할 때 targetField 값으로 표의 행을 찾음
+    bool addJoin(const QString &targetField, const QString &tablePath, const QString &joinField,
+                 const QStringList &fieldNames = QStringList(), const QString &prefix = QString());
+    void removeJoin(const QString &tablePath);
+    void removeAllJoins();
+    QStringList joinedFields() const;
+    bool isJoinedField(const QString &fieldName) const;
+    
+    // 피처 속성으로 가상 열 값 조회 (조인되는 행이 없으면 무효 QVariant)
+    QVariant joinedValue(const QVariantMap &attributes, const QString &fieldName) const;
+    
+    // 속성 색인 (해시: 같은 값 검색, 정렬: 범위 검색)
+    // 데이터 파일 옆에 저장해 두고 다음에 열 때 원본이 바뀌지 않았으면 자동으로 불러옴
+    bool createAttributeIndex(const QString &fieldName,
+                              HGISAttributeIndex::Type type = HGISAttributeIndex::HashIndex);
+    void removeAttributeIndex(const QString &fieldName);
+    bool hasAttributeIndex(const QString &fieldName) const;
+    QStringList indexedFields() const;
+    
+    // 속성 검색 - 피처 ID 오름차순 (색인이 있으면 사용, 없으면 전체 순회)
+    QVector<long> findFeatures(const QString &fieldName, const QVariant &value) const;
+    QVector<long> findFeaturesInRange(const QString &fieldName,
+                                      const QVariant &minimum, const QVariant &maximum) const;
+    
+    // 필드 값 순서로 나열한 전체 피처 ID (NULL은 오름차순에서 마지막)
+    // 숫자 필드에 속성 색인이 있으면 색인 순서를 그대로 쓰고, 아니면 정렬 엔진으로 정렬
+    QVector<long> sortedFeatureIds(const QString &fieldName, bool descending = false) const;
+    
+    // 여러 필드 기준 정렬 (문자열은 한국어 정렬 순서, 같은 키는 피처 순서 유지)
+    QVector<long> sortFeatureIds(const QVector<HGISSortKey> &keys) const;
+    
+    // 그룹 집계 (예: groupBy({"시대", "시군구"}) -> 조합별 유적 수), 그룹 키 순서로 정렬
+    QVector<HGISGroup> groupBy(const QStringList &groupFields,
+                               const QStringList &aggregateFields = QStringList()) const;
+    
+    // 전체 텍스트 검색 (문자열 필드의 bigram + 초성 색인, 백그라운드 생성)
+    // 필드 목록이 비어 있으면 모든 문자열 필드
+    void setTextSearchFields(const QStringList &fieldNames);
+    QStringList textSearchFields() const;
+    void buildTextSearchIndex();
+    HGISTextSearchIndex* textSearchIndex() const;
+    
+    // 검색어를 포함하는 피처 ID (색인이 준비되지 않았으면 생성을 시작하고 빈 목록)
+    QVector<long> searchText(const QString &query, int limit = 0) const;
+    
+    // 점 군집 계층 (PointCluster 렌더러로 처음 그릴 때 백그라운드 생성, 준비되면 다시 그림)
+    HGISPointClusterIndex* pointClusterIndex() const;
+    
+    // 피처들의 범위 (레이어 좌표계)
+    QRectF featuresExtent(const QVector<long> &featureIds) const;
+    
     // 렌더링
     void render(QPainter *painter, const QRectF &extent, double scale) override;
     
+    // 렌더링 좌표계 (레이어 좌표계와 다르면 실시간 재투영)
+    HGISCoordinateReferenceSystem renderCrs() const;
+    void setRenderCrs(const HGISCoordinateReferenceSystem &crs);
+    
     // 복제
     HGISMapLayer* clone() const override;
     
     // 유효성
     bool isValid() const override;
     
-    // 통계
+    // 읽어 둔 피처의 좌표 저장 방식
+    // 양자화는 레이어 원점 기준 int32 (resolution 단위, 기본 1mm)로 좌표 메모리를 절반으로 줄임
+    // 보이지 않는 레이어는 이 설정과 관계없이 차분 varint로 압축해 두고 다시 보일 때 이 방식으로 풂
+    HGISCoordinateEncoding coordinateEncoding() const;
+    double coordinateResolution() const;
+    void setCoordinateEncoding(HGISCoordinateEncoding encoding, double resolution = 0.001);
+    
+    // 읽을 때 피처를 범위 중심의 힐베르트 곡선 순서로 다시 배열 (기본 꺼짐)
+    // 가까운 피처가 좌표/속성 버퍼에서도 이웃해 화면 범위 질의가 메모리를 덜 흩어 읽음
+    // features()와 featureIds()는 이 순서, 검색 결과는 FID 순서 (정렬 결과의 같은 값 순서는 읽어 둔 순서)
+    bool spatialOrdering() const;
+    void setSpatialOrdering(bool enabled);
+    
+    // 메모리 사용량 추정 (피처 캐시, 속성 색인, 조인 표)
+    HGISCacheUsage memoryUsage() const;
+    
+    // 읽어 둔 피처 비우기 (필요하면 제공자에서 다시 읽음)
+    void releaseFeatureCache();
+    
+    // 통계 (dataChanged 전까지 필드별로 캐시)
+    // 여러 필드를 한 번에 요청하면 캐시에 없는 필드를 한 번의 순회로 계산
+    HGISFieldStatistics statistics(const QString &fieldName) const;
+    QVector<HGISFieldStatistics> statistics(const QStringList &fieldNames) const;
     double minimumValue(const QString &fieldName) const;
     double maximumValue(const QString &fieldName) const;
-    QVariant uniqueValues(const QString &fieldName) const;
+    QVariant uniqueValues(const QString &fieldName) const;   // 고유값이 많으면 (4096개 초과) 빈 목록
+    
+    // 근사 요약 (HyperLogLog 고유값 수 + 빈도 상위 값, 고유값 목록은 만들지 않음)
+    // 자유 텍스트처럼 고유값이 매우 많은 필드에도 메모리가 일정
+    HGISFieldStatistics fieldSummary(const QString &fieldName) const;
+    double approximateDistinctCount(const QString &fieldName) const;
+    
+    // 분류 심볼 설정용 - 고유값이 maxCategories 이하인지 판단
+    // 표본만으로 초과가 확실하면 전체를 읽지 않고 false
+    bool isCategorizable(const QString &fieldName, int maxCategories = 64) const;
+    
+    // 분류 심볼 설정용 - 빈도 내림차순 상위 값
+    QVariantList categoryValues(const QString &fieldName, int maxCategories = 64) const;
     
 signals:
     void selectionChanged(const QSet<long> &selectedIds);
@@ -137,6 +266,8 @@ signals:
     
 private:
     void renderFeatures(QPainter *painter, const QRectF &extent, double scale);
+    bool renderClusters(QPainter *painter, const QRectF &extent, const QRectF &sourceExtent);
+    void renderHeatmap(QPainter *painter, const HGISFeatureSnapshot &snapshot);
     void renderLabels(QPainter *painter, const QRectF &extent, double scale);
     void drawPointSymbol(QPainter *painter, const QPointF &point, const HGISSymbol &symbol);
     void drawLineSymbol(QPainter *painter, const QVector<QPointF> &points, const HGISSymbol &symbol);
@@ -0,0 +1,89 @@
+#include "HGISWorkerPool.h"
+#include <QThread>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class HGISWorkerPool::Private
+{
+public:
+    std::vector<std::thread> threads;
+    std::deque<std::function<void(int)>> queue;
+    std::mutex mutex;
+    std::condition_variable taskAvailable;
+    std::condition_variable spaceAvailable;
+    std::size_t capacity = 0;       // 0이면 상한 없음
+    bool stopping = false;
+    
+    // 작업 스레드 본체 - 종료 요청을 받아도 대기열이 빌 때까지 처리
+    void run(int worker)
+    {
+        for (;;) {
+            std::function<void(int)> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                taskAvailable.wait(lock, [this] { return stopping || !queue.empty(); });
+                if (queue.empty()) {
+                    return;
+                }
+                task = std::move(queue.front());
+                queue.pop_front();
+            }
+            spaceAvailable.notify_one();
+            task(worker);
+        }
+    }
+};
+
+HGISWorkerPool::HGISWorkerPool(int threadCount, int queueCapacity)
+    : d(std::make_unique<Private>())
+{
+    if (threadCount <= 0) {
+        threadCount = qMax(1, QThread::idealThreadCount());
+    }
+    d->capacity = queueCapacity > 0 ? static_cast<std::size_t>(queueCapacity) : 0;
+    
+    d->threads.reserve(static_cast<std::size_t>(threadCount));
+    for (int worker = 0; worker < threadCount; ++worker) {
+        Private *p = d.get();
+        d->threads.emplace_back([p, worker] { p->run(worker); });
+    }
+}
+
+HGISWorkerPool::~HGISWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(d->mutex);
+        d->stopping = true;
+    }
+    d->taskAvailable.notify_all();
+    for (std::thread &thread : d->threads) {
+        thread.join();
+    }
+}
+
+HGISWorkerPool &HGISWorkerPool::globalInstance()
+{
+    // 종료 시 작업 스레드를 기다리지 않도록 해제하지 않음
+    static HGISWorkerPool *pool = new HGISWorkerPool();
+    return *pool;
+}
+
+int HGISWorkerPool::threadCount() const
+{
+    return static_cast<int>(d->threads.size());
+}
+
+void HGISWorkerPool::enqueue(std::function<void(int)> task)
+{
+    {
+        std::unique_lock<std::mutex> lock(d->mutex);
+        if (d->capacity > 0) {
+            d->spaceAvailable.wait(lock, [this] { return d->queue.size() < d->capacity; });
+        }
+        d->queue.push_back(std::move(task));
+    }
+    d->taskAvailable.notify_one();
+}
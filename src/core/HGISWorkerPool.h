@@ -0,0 +1,55 @@
+#ifndef HGISWORKERPOOL_H
+#define HGISWORKERPOOL_H
+
+#include <QtGlobal>
+#include <functional>
+#include <future>
+#include <memory>
+
+#ifdef HGIS_CORE_EXPORT
+  #define CORE_EXPORT Q_DECL_EXPORT
+#else
+  #define CORE_EXPORT Q_DECL_IMPORT
+#endif
+
+// 고정된 수의 작업 스레드가 작업 대기열을 차례로 비우는 스레드 풀
+// 작업마다 스레드를 새로 만들지 않으며, 작업은 자신을 실행하는 작업 스레드 번호 (0 ~ threadCount - 1)를 받음
+// 스레드 간에 공유할 수 없는 자원 (PROJ 변환 객체 등)은 작업 스레드마다 하나씩 두고 번호로 골라 씀
+// 대기열에 상한을 주면 가득 찼을 때 submit이 빈 자리가 날 때까지 기다림 (읽기가 처리보다 빠를 때)
+// 작업 안에서 같은 풀의 다른 작업을 기다리면 안 됨 (모든 작업 스레드가 기다리면 멈춤)
+class CORE_EXPORT HGISWorkerPool
+{
+public:
+    // threadCount가 0 이하면 CPU 코어 수, queueCapacity가 0 이하면 대기열 상한 없음
+    explicit HGISWorkerPool(int threadCount = 0, int queueCapacity = 0);
+    
+    // 대기열에 남은 작업을 모두 마친 뒤 작업 스레드 종료
+    ~HGISWorkerPool();
+    
+    // 프로세스 전역 풀 (CPU 코어 수) - 정렬/통계처럼 짧은 병렬 구간용
+    static HGISWorkerPool &globalInstance();
+    
+    int threadCount() const;
+    
+    // 작업 추가 - function(int worker)의 결과 (또는 예외)는 future로 받음
+    template <typename Function>
+    auto submit(Function function) -> std::future<decltype(function(0))>
+    {
+        using Result = decltype(function(0));
+        auto task = std::make_shared<std::packaged_task<Result(int)>>(std::move(function));
+        std::future<Result> future = task->get_future();
+        enqueue([task](int worker) { (*task)(worker); });
+        return future;
+    }
+    
+private:
+    HGISWorkerPool(const HGISWorkerPool &) = delete;
+    HGISWorkerPool &operator=(const HGISWorkerPool &) = delete;
+    
+    void enqueue(std::function<void(int)> task);
+    
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+#endif // HGISWORKERPOOL_H
@@ -0,0 +1,349 @@
+#include "HGISAttributeTableModel.h"
+#include "core/HGISVectorLayer.h"
+#include <QBrush>
+#include <QColor>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <climits>
+
+HGISAttributeTableModel::HGISAttributeTableModel(HGISVectorLayer *layer, QObject *parent)
+    : QAbstractTableModel(parent)
+    , m_layer(layer)
+{
+    m_pages.setMaxCost(64);
+    
+    if (m_layer) {
+        m_fields = m_layer->fields();
+        m_rowCount = static_cast<int>(qBound(0L, m_layer->featureCount(), static_cast<long>(INT_MAX)));
+        
+        // 선택이 바뀌면 보이는 행만 다시 그리도록 배경색 변경만 알림
+        connect(layer, &HGISVectorLayer::selectionChanged, this, [this]() {
+            if (m_rowCount > 0 && !m_fields.isEmpty()) {
+                emit dataChanged(index(0, 0), index(m_rowCount - 1, m_fields.size() - 1),
+                                 {Qt::BackgroundRole, SelectedRole});
+            }
+        });
+        connect(layer, &HGISMapLayer::dataChanged, this, &HGISAttributeTableModel::reload);
+    }
+}
+
+HGISAttributeTableModel::~HGISAttributeTableModel() = default;
+
+int HGISAttributeTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rowCount;
+}
+
+int HGISAttributeTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_fields.size();
+}
+
+QVariant HGISAttributeTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_rowCount || index.column() >= m_fields.size()) {
+        return QVariant();
+    }
+    
+    switch (role) {
+        case Qt::DisplayRole:
+        case Qt::EditRole: {
+            const HGISGdalProvider::Feature *f = feature(index.row());
+            return f ? value(*f, index.column()) : QVariant();
+        }
+        case Qt::TextAlignmentRole: {
+            const HGISGdalProvider::Feature *f = feature(index.row());
+            if (!f) {
+                return QVariant();
+            }
+            const QVariant cell = value(*f, index.column());
+            const bool numeric = cell.type() == QVariant::Int || cell.type() == QVariant::LongLong
+                                 || cell.type() == QVariant::Double;
+            return numeric ? int(Qt::AlignRight | Qt::AlignVCenter) : int(Qt::AlignLeft | Qt::AlignVCenter);
+        }
+        case Qt::BackgroundRole: {
+            const long id = featureId(index.row());
+            if (id >= 0 && m_layer && m_layer->isFeatureSelected(id)) {
+                return QBrush(QColor(255, 230, 120));
+            }
+            return QVariant();
+        }
+        case FeatureIdRole: {
+            const long id = featureId(index.row());
+            return id >= 0 ? QVariant(static_cast<qlonglong>(id)) : QVariant();
+        }
+        case SelectedRole: {
+            const long id = featureId(index.row());
+            return id >= 0 && m_layer && m_layer->isFeatureSelected(id);
+        }
+        default:
+            return QVariant();
+    }
+}
+
+QVariant HGISAttributeTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation == Qt::Horizontal) {
+        if (section < 0 || section >= m_fields.size()) {
+            return QVariant();
+        }
+        if (role == Qt::DisplayRole) {
+            return m_fields[section];
+        }
+        if (role == Qt::ToolTipRole && m_layer) {
+            const QString &fieldName = m_fields[section];
+            if (m_layer->isJoinedField(fieldName)) {
+                return QString("%1 (조인한 표의 필드)").arg(fieldName);
+            }
+            
+            QStringList lines;
+            lines << (m_layer->hasAttributeIndex(fieldName) ? QString("%1 (속성 색인 있음)").arg(fieldName)
+                                                             : fieldName);
+            
+            // 근사 요약 (레이어가 필드별로 캐시 - 처음 볼 때만 한 번 순회)
+            const HGISFieldStatistics summary = m_layer->fieldSummary(fieldName);
+            if (summary.count > 0) {
+                lines << QString("고유값: 약 %1개").arg(qRound64(summary.approximateDistinctCount()));
+                QStringList top;
+                for (const HGISValueCount &entry : summary.topValues(kTooltipTopValues)) {
+                    top << QString("%1 (%2)").arg(entry.value.toString()).arg(entry.count);
+                }
+                if (!top.isEmpty()) {
+                    lines << QString("빈도 상위: %1").arg(top.join(", "));
+                }
+            }
+            return lines.join('\n');
+        }
+        return QVariant();
+    }
+    
+    // 세로 헤더는 피처 ID (보이는 행만 요청되므로 이미 읽은 페이지)
+    if (role == Qt::DisplayRole && section >= 0 && section < m_rowCount) {
+        const long id = featureId(section);
+        return id >= 0 ? QVariant(static_cast<qlonglong>(id)) : QVariant(section + 1);
+    }
+    return QVariant();
+}
+
+void HGISAttributeTableModel::sort(int column, Qt::SortOrder order)
+{
+    if (!m_layer || column >= m_fields.size()) {
+        return;
+    }
+    if (column == m_sortColumn && (column < 0 || order == m_sortOrder)) {
+        return;
+    }
+    
+    QElapsedTimer timer;
+    timer.start();
+    
+    // FID 순서만 가져오고 행은 읽지 않음 (색인 순서 또는 정렬 엔진)
+    QVector<long> sortedIds;
+    if (column >= 0) {
+        sortedIds = m_layer->sortedFeatureIds(m_fields[column], order == Qt::DescendingOrder);
+        if (sortedIds.isEmpty() && m_rowCount > 0) {
+            qWarning() << "속성 테이블 정렬 실패:" << m_fields[column];
+            return;
+        }
+    }
+    
+    beginResetModel();
+    m_sortColumn = column;
+    m_sortOrder = order;
+    m_sortedIds = sortedIds;
+    m_rowCount = column >= 0
+        ? m_sortedIds.size()
+        : static_cast<int>(qBound(0L, m_layer->featureCount(), static_cast<long>(INT_MAX)));
+    m_pages.clear();
+    endResetModel();
+    
+    qDebug() << "속성 테이블 정렬:" << (column >= 0 ? m_fields[column] : QString("FID"))
+             << timer.elapsed() << "ms";
+}
+
+HGISVectorLayer* HGISAttributeTableModel::layer() const
+{
+    return m_layer;
+}
+
+long HGISAttributeTableModel::featureId(int row) const
+{
+    if (row < 0 || row >= m_rowCount) {
+        return -1;
+    }
+    if (m_sortColumn >= 0) {
+        return m_sortedIds[row];
+    }
+    const HGISGdalProvider::Feature *f = feature(row);
+    return f ? f->id : -1;
+}
+
+int HGISAttributeTableModel::rowOfFeature(long featureId) const
+{
+    if (featureId < 0) {
+        return -1;
+    }
+    if (m_sortColumn >= 0) {
+        return m_sortedIds.indexOf(featureId);
+    }
+    
+    // Shapefile은 FID = 읽기 순서, GeoPackage 등은 보통 FID = 읽기 순서 + 1
+    for (long guess : {featureId, featureId - 1}) {
+        if (guess >= 0 && guess < m_rowCount && this->featureId(static_cast<int>(guess)) == featureId) {
+            return static_cast<int>(guess);
+        }
+    }
+    
+    for (int pageNumber : m_pages.keys()) {
+        const Page *cached = m_pages.object(pageNumber);
+        for (std::size_t i = 0; i < cached->features.size(); ++i) {
+            if (cached->features[i].id == featureId) {
+                return pageNumber * kPageSize + static_cast<int>(i);
+            }
+        }
+    }
+    return -1;
+}
+
+void HGISAttributeTableModel::setMaximumCachedPages(int pages)
+{
+    m_pages.setMaxCost(qMax(1, pages));
+}
+
+int HGISAttributeTableModel::maximumCachedPages() const
+{
+    return m_pages.maxCost();
+}
+
+void HGISAttributeTableModel::reload()
+{
+    beginResetModel();
+    m_pages.clear();
+    m_pageLastFids.clear();
+    m_fidLayout = -1;
+    if (m_layer) {
+        m_fields = m_layer->fields();
+        m_rowCount = static_cast<int>(qBound(0L, m_layer->featureCount(), static_cast<long>(INT_MAX)));
+        if (m_sortColumn >= 0 && m_sortColumn < m_fields.size()) {
+            m_sortedIds = m_layer->sortedFeatureIds(m_fields[m_sortColumn], m_sortOrder == Qt::DescendingOrder);
+            m_rowCount = m_sortedIds.size();
+        } else {
+            m_sortColumn = -1;
+            m_sortedIds.clear();
+        }
+    } else {
+        m_fields.clear();
+        m_rowCount = 0;
+        m_sortColumn = -1;
+        m_sortedIds.clear();
+    }
+    endResetModel();
+}
+
+QVariant HGISAttributeTableModel::value(const HGISGdalProvider::Feature &feature, int column) const
+{
+    // 조인한 가상 열은 페이지에 없으므로 대상 키로 조인 표에서 찾음
+    auto it = feature.attributes.constFind(m_fields[column]);
+    if (it != feature.attributes.constEnd()) {
+        return it.value();
+    }
+    return m_layer ? m_layer->joinedValue(feature.attributes, m_fields[column]) : QVariant();
+}
+
+const HGISGdalProvider::Feature* HGISAttributeTableModel::feature(int row) const
+{
+    const Page *cached = page(row / kPageSize);
+    const std::size_t offset = static_cast<std::size_t>(row % kPageSize);
+    if (!cached || offset >= cached->features.size() || cached->features[offset].id < 0) {
+        return nullptr;
+    }
+    return &cached->features[offset];
+}
+
+const HGISAttributeTableModel::Page* HGISAttributeTableModel::page(int pageNumber) const
+{
+    if (const Page *cached = m_pages.object(pageNumber)) {
+        return cached;
+    }
+    if (!m_layer || !m_layer->dataProvider()) {
+        return nullptr;
+    }
+    
+    const HGISGdalProvider *provider = m_layer->dataProvider();
+    const int first = pageNumber * kPageSize;
+    const int count = qMin(kPageSize, m_rowCount - first);
+    if (count <= 0) {
+        return nullptr;
+    }
+    
+    Page *loaded = new Page;
+    if (m_sortColumn >= 0) {
+        // 읽지 못한 FID (정렬 뒤 삭제 등) 는 건너뛰고 돌아오므로 행 자리를 맞춤
+        // 빈 자리는 FID -1 로 두어 feature(row)가 다른 피처를 돌려주지 않게 함
+        const QVector<long> ids = m_sortedIds.mid(first, count);
+        std::vector<HGISGdalProvider::Feature> found = provider->readFeatures(ids);
+        loaded->features.resize(static_cast<std::size_t>(ids.size()));
+        std::size_t next = 0;
+        for (int i = 0; i < ids.size(); ++i) {
+            HGISGdalProvider::Feature &slot = loaded->features[static_cast<std::size_t>(i)];
+            if (next < found.size() && found[next].id == ids[i]) {
+                slot = std::move(found[next++]);
+            } else {
+                slot.id = -1;
+            }
+        }
+    } else {
+        loaded->features = readUnsortedPage(pageNumber, first, count);
+        if (!loaded->features.empty()) {
+            m_pageLastFids.insert(pageNumber, loaded->features.back().id);
+        }
+    }
+    
+    // 캐시가 가득 차면 가장 오래 쓰지 않은 페이지가 빠짐
+    m_pages.insert(pageNumber, loaded);
+    return loaded;
+}
+
+std::vector<HGISGdalProvider::Feature> HGISAttributeTableModel::readUnsortedPage(int pageNumber, int first,
+                                                                                 int count) const
+{
+    const HGISGdalProvider *provider = m_layer->dataProvider();
+    
+    // Shapefile처럼 위치로 바로 이동할 수 있으면 읽기 순서 구간
+    if (provider->supportsFastPaging()) {
+        return provider->readFeaturePage(first, count);
+    }
+    
+    // GeoJSON, GeoPackage 등은 위치 이동이 앞부분을 다시 읽으므로 FID 범위로 읽음
+    // 앞 페이지를 읽었으면 그 마지막 FID 다음부터, FID가 빈틈없으면 첫 FID + 행 번호부터
+    if (pageNumber == 0) {
+        return provider->readFeaturesAfter(-1, count);
+    }
+    auto previous = m_pageLastFids.constFind(pageNumber - 1);
+    if (previous != m_pageLastFids.constEnd()) {
+        return provider->readFeaturesAfter(previous.value(), count);
+    }
+    if (fidsContiguous()) {
+        return provider->readFeaturesAfter(m_firstFid + first - 1, count);
+    }
+    
+    // FID에 빈틈이 있는 표에서 멀리 건너뛴 경우만 위치 이동
+    return provider->readFeaturePage(first, count);
+}
+
+bool HGISAttributeTableModel::fidsContiguous() const
+{
+    if (m_fidLayout < 0) {
+        // 첫 FID와 행 수로 마지막 FID를 추정해 양 끝만 확인 (FID가 읽기 순서로 증가하는 드라이버)
+        m_fidLayout = 0;
+        const HGISGdalProvider *provider = m_layer->dataProvider();
+        const std::vector<HGISGdalProvider::Feature> head = provider->readFeaturesAfter(-1, 1);
+        if (!head.empty() && m_rowCount > 0) {
+            m_firstFid = head.front().id;
+            HGISGdalProvider::Feature probe;
+            const long lastFid = m_firstFid + m_rowCount - 1;
+            m_fidLayout = provider->readFeature(lastFid, probe) && !provider->readFeature(lastFid + 1, probe) ? 1 : 0;
+        }
+    }
+    return m_fidLayout == 1;
+}
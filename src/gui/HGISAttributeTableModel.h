@@ -0,0 +1,88 @@
+#ifndef HGISATTRIBUTETABLEMODEL_H
+#define HGISATTRIBUTETABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QCache>
+#include <QHash>
+#include <QPointer>
+#include <QStringList>
+#include <QVector>
+#include <vector>
+#include "providers/HGISGdalProvider.h"
+
+class HGISVectorLayer;
+
+// 벡터 레이어 속성 테이블 모델
+// 행을 미리 읽지 않고 화면에 보이는 페이지만 제공자에서 읽어 개수가 제한된 캐시에 보관
+// - 기본 순서: 제공자의 읽기 순서 구간을 바로 읽음 (지오메트리 제외)
+//   임의 접근이 느린 드라이버는 앞 페이지의 마지막 FID 다음부터 FID 범위로 읽음
+// - 정렬: 정렬된 FID 순서만 보관하고 페이지마다 FID로 임의 접근
+// 선택 상태는 복사하지 않고 행을 그릴 때 레이어에 물어봄
+class HGISAttributeTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+    
+public:
+    enum Roles {
+        FeatureIdRole = Qt::UserRole,
+        SelectedRole
+    };
+    
+    static constexpr int kPageSize = 256;
+    static constexpr int kTooltipTopValues = 5;    // 헤더 도움말에 보일 빈도 상위 값 수
+    
+    explicit HGISAttributeTableModel(HGISVectorLayer *layer, QObject *parent = nullptr);
+    ~HGISAttributeTableModel() override;
+    
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+    
+    // 열 기준 정렬 (column < 0 이면 원래 순서)
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+    
+    HGISVectorLayer* layer() const;
+    
+    // 행의 피처 ID (없으면 -1)
+    long featureId(int row) const;
+    
+    // 피처가 있는 행 (찾지 못하면 -1)
+    // 정렬 상태에서는 FID 순서에서, 원래 순서에서는 캐시된 페이지와 FID = 행 번호 추정으로 찾음
+    int rowOfFeature(long featureId) const;
+    
+    // 캐시할 최대 페이지 수 (기본 64페이지 = 16384행)
+    void setMaximumCachedPages(int pages);
+    int maximumCachedPages() const;
+    
+    // 데이터가 바뀌었을 때 캐시를 비우고 다시 읽음 (정렬 유지)
+    void reload();
+    
+private:
+    struct Page {
+        std::vector<HGISGdalProvider::Feature> features;
+    };
+    
+    const HGISGdalProvider::Feature* feature(int row) const;
+    QVariant value(const HGISGdalProvider::Feature &feature, int column) const;
+    const Page* page(int pageNumber) const;
+    std::vector<HGISGdalProvider::Feature> readUnsortedPage(int pageNumber, int first, int count) const;
+    bool fidsContiguous() const;
+    
+    QPointer<HGISVectorLayer> m_layer;
+    QStringList m_fields;
+    int m_rowCount = 0;
+    
+    int m_sortColumn = -1;
+    Qt::SortOrder m_sortOrder = Qt::AscendingOrder;
+    QVector<long> m_sortedIds;          // 행 -> FID (정렬 상태에서만)
+    
+    mutable QCache<int, Page> m_pages;  // 페이지 번호 -> 피처
+    
+    // 원래 순서 페이지의 마지막 FID (페이지가 캐시에서 빠져도 유지, FID 범위 읽기의 시작점)
+    mutable QHash<int, long> m_pageLastFids;
+    mutable int m_fidLayout = -1;       // FID가 첫 FID부터 빈틈없이 이어지는지 (-1: 아직 모름, 0/1)
+    mutable long m_firstFid = -1;
+};
+
+#endif // HGISATTRIBUTETABLEMODEL_H
@@ -0,0 +1,75 @@
+#include "HGISCrsListModel.h"
+#include "core/HGISCrsCatalog.h"
+#include <QBrush>
+#include <QColor>
+
+HGISCrsListModel::HGISCrsListModel(HGISCrsCatalog *catalog, QObject *parent)
+    : QAbstractListModel(parent)
+    , m_catalog(catalog)
+{
+    m_rows = m_catalog->search(QString());
+    
+    // 백그라운드 로드가 끝나면 현재 검색어로 다시 채움
+    connect(m_catalog, &HGISCrsCatalog::loaded, this, [this]() {
+        setFilterText(m_filterText);
+    });
+}
+
+int HGISCrsListModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rows.size();
+}
+
+QVariant HGISCrsListModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_rows.size()) {
+        return QVariant();
+    }
+    
+    const HGISCrsCatalog::Entry &entry = m_catalog->entry(m_rows[index.row()]);
+    
+    switch (role) {
+        case Qt::DisplayRole:
+            if (entry.deprecated) {
+                return QString("EPSG:%1 - %2 (폐지됨)").arg(entry.epsg).arg(entry.name);
+            }
+            return QString("EPSG:%1 - %2").arg(entry.epsg).arg(entry.name);
+        case Qt::ToolTipRole:
+            return entry.areaName.isEmpty() ? entry.description : entry.areaName;
+        case Qt::ForegroundRole:
+            if (entry.deprecated) {
+                return QBrush(QColor(150, 150, 150));
+            }
+            return QVariant();
+        case EpsgRole:
+            return entry.epsg;
+        case NameRole:
+            return entry.name;
+        case DescriptionRole:
+            return entry.description;
+        default:
+            return QVariant();
+    }
+}
+
+void HGISCrsListModel::setFilterText(const QString &text)
+{
+    beginResetModel();
+    m_filterText = text;
+    m_rows = m_catalog->search(text);
+    endResetModel();
+}
+
+QString HGISCrsListModel::filterText() const
+{
+    return m_filterText;
+}
+
+int HGISCrsListModel::rowOfEpsg(int epsg) const
+{
+    const int catalogIndex = m_catalog->indexOfEpsg(epsg);
+    if (catalogIndex < 0) {
+        return -1;
+    }
+    return m_rows.indexOf(catalogIndex);
+}
@@ -0,0 +1,40 @@
+#ifndef HGISCRSLISTMODEL_H
+#define HGISCRSLISTMODEL_H
+
+#include <QAbstractListModel>
+#include <QVector>
+
+class HGISCrsCatalog;
+
+// 좌표계 카탈로그 검색 결과를 보여주는 목록 모델
+// 카탈로그 인덱스 배열만 보관하고 표시 문자열은 data()에서 필요할 때 생성
+class HGISCrsListModel : public QAbstractListModel
+{
+    Q_OBJECT
+    
+public:
+    enum Roles {
+        EpsgRole = Qt::UserRole,
+        NameRole,
+        DescriptionRole
+    };
+    
+    explicit HGISCrsListModel(HGISCrsCatalog *catalog, QObject *parent = nullptr);
+    
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    
+    // 검색어 적용 (카탈로그 재로드 시 같은 검색어로 다시 호출)
+    void setFilterText(const QString &text);
+    QString filterText() const;
+    
+    // EPSG 코드에 해당하는 행 (없으면 -1)
+    int rowOfEpsg(int epsg) const;
+    
+private:
+    HGISCrsCatalog *m_catalog = nullptr;
+    QVector<int> m_rows;    // 행 -> 카탈로그 인덱스
+    QString m_filterText;
+};
+
+#endif // HGISCRSLISTMODEL_H
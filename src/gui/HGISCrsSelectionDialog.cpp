@@ -1,19 +1,23 @@
 #include "HGISCrsSelectionDialog.h"
+#include "HGISCrsListModel.h"
+#include "core/HGISCrsCatalog.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
-#include <QListWidget>
+#include <QListView>
 #include <QLineEdit>
 #include <QTextEdit>
 #include <QPushButton>
 #include <QLabel>
 #include <QGroupBox>
 #include <QDialogButtonBox>
-#include <QListWidgetItem>
+#include <QItemSelectionModel>
 
 class HGISCrsSelectionDialog::Private
 {
 public:
-    QListWidget *crsList = nullptr;
+    QListView *crsList = nullptr;
+    HGISCrsListModel *crsModel = nullptr;
+    QLabel *countLabel = nullptr;
     QLineEdit *searchEdit = nullptr;
     QTextEdit *detailsEdit = nullptr;
     QPushButton *korea2000Btn = nullptr;
@@ -21,14 +25,6 @@ public:
     QPushButton *wgs84Btn = nullptr;
     
     HGISCoordinateReferenceSystem selectedCrs;
-    
-    struct CrsInfo {
-        int epsg;
-        QString name;
-        QString description;
-    };
-    
-    QList<CrsInfo> allCrsList;
 };
 
 HGISCrsSelectionDialog::HGISCrsSelectionDialog(QWidget *parent)
@@ -81,9 +77,15 @@ void HGISCrsSelectionDialog::setupUi()
     // CRS 목록
     QVBoxLayout *listLayout = new QVBoxLayout();
     QLabel *listLabel = new QLabel("좌표계 목록:");
-    d->crsList = new QListWidget();
+    d->crsList = new QListView();
+    d->crsList->setUniformItemSizes(true);  // 수천 개 항목에서도 보이는 행만 배치
+    d->crsList->setSelectionMode(QAbstractItemView::SingleSelection);
+    d->crsModel = new HGISCrsListModel(HGISCrsCatalog::instance(), this);
+    d->crsList->setModel(d->crsModel);
+    d->countLabel = new QLabel();
     listLayout->addWidget(listLabel);
     listLayout->addWidget(d->crsList);
+    listLayout->addWidget(d->countLabel);
     contentLayout->addLayout(listLayout, 2);
     
     // 상세 정보
@@ -105,7 +107,7 @@ void HGISCrsSelectionDialog::setupUi()
     // 시그널 연결
     connect(d->searchEdit, &QLineEdit::textChanged,
             this, &HGISCrsSelectionDialog::onSearchTextChanged);
-    connect(d->crsList, &QListWidget::itemSelectionChanged,
+    connect(d->crsList->selectionModel(), &QItemSelectionModel::currentChanged,
             this, &HGISCrsSelectionDialog::onCrsSelectionChanged);
     connect(d->korea2000Btn, &QPushButton::clicked,
             this, [this]() {
@@ -128,71 +130,54 @@ void HGISCrsSelectionDialog::setupUi()
 
 void HGISCrsSelectionDialog::populateCrsList()
 {
-    // 주요 좌표계 목록
-    d->allCrsList.clear();
-    
-    // 전세계 좌표계
-    d->allCrsList.append({4326, "WGS 84", "World Geodetic System 1984"});
-    d->allCrsList.append({3857, "WGS 84 / Pseudo-Mercator", "Web Mercator projection"});
-    
-    // 한국 좌표계 - Korea 2000 TM (현재 표준)
-    d->allCrsList.append({5186, "Korea 2000 / Central Belt", "Korea 2000 / Central Belt 중부원점 TM"});
-    d->allCrsList.append({5185, "Korea 2000 / West Belt", "Korea 2000 / West Belt 서부원점 TM"});
-    d->allCrsList.append({5187, "Korea 2000 / East Belt", "Korea 2000 / East Belt 동부원점 TM"});
-    d->allCrsList.append({5188, "Korea 2000 / East Sea Belt", "Korea 2000 / East Sea Belt 동해(울릉)원점 TM"});
-    d->allCrsList.append({5179, "Korea 2000 / Unified CS (UTM-K)", "Korea 2000 통일원점 (네이버 지도)"});
-    
-    // 한국 좌표계 - Korean 1985 (Bessel)
-    d->allCrsList.append({5174, "Korean 1985 / Central Belt", "Korean 1985 중부원점 (Bessel)"});
-    d->allCrsList.append({5175, "Korean 1985 / West Belt", "Korean 1985 서부원점 (Bessel)"});
-    d->allCrsList.append({5176, "Korean 1985 / East Belt", "Korean 1985 동부원점 (Bessel)"});
-    d->allCrsList.append({5177, "Korean 1985 / East Sea Belt", "Korean 1985 동해원점 (Bessel)"});
-    d->allCrsList.append({5178, "Korean 1985 / Unified CS", "Korean 1985 통일원점 (Bessel)"});
-    
-    // 한국 좌표계 - Korea 2000 지리좌표계
-    d->allCrsList.append({4737, "Korea 2000", "Korea 2000 지리좌표계 (GRS80)"});
-    d->allCrsList.append({4162, "Korean 1985", "Korean 1985 지리좌표계 (Bessel)"});
-    
-    // UTM 좌표계 (한국 지역)
-    d->allCrsList.append({32651, "WGS 84 / UTM zone 51N", "한국 서부 지역 UTM"});
-    d->allCrsList.append({32652, "WGS 84 / UTM zone 52N", "한국 동부 지역 UTM"});
-    
-    // 목록에 추가
-    for (const auto &crs : d->allCrsList) {
-        addCrsItem(crs.epsg, crs.name, crs.description);
-    }
+    // 주요 좌표계는 바로 표시하고, 전체 EPSG 목록은 백그라운드에서 로드
+    HGISCrsCatalog *catalog = HGISCrsCatalog::instance();
+    
+    auto updateCount = [this, catalog]() {
+        d->countLabel->setText(catalog->isLoaded()
+            ? QString("%1 / %2개 좌표계").arg(d->crsModel->rowCount()).arg(catalog->count())
+            : QString("전체 좌표계 목록을 불러오는 중..."));
+    };
+    
+    connect(d->crsModel, &QAbstractItemModel::modelReset, this, [this, updateCount]() {
+        updateCount();
+        // 재검색 후에도 선택한 좌표계 유지
+        selectEpsg(d->selectedCrs.epsgCode());
+    });
+    
+    updateCount();
+    catalog->loadInBackground();
 }
 
-void HGISCrsSelectionDialog::addCrsItem(int epsg, const QString &name, const QString &description)
+void HGISCrsSelectionDialog::selectEpsg(int epsg)
 {
-    QListWidgetItem *item = new QListWidgetItem(d->crsList);
-    item->setText(QString("EPSG:%1 - %2").arg(epsg).arg(name));
-    item->setData(Qt::UserRole, epsg);
-    item->setData(Qt::UserRole + 1, name);
-    item->setData(Qt::UserRole + 2, description);
+    int row = d->crsModel->rowOfEpsg(epsg);
+    if (row >= 0) {
+        QModelIndex index = d->crsModel->index(row);
+        d->crsList->setCurrentIndex(index);
+        d->crsList->scrollTo(index);
+    }
 }
 
 void HGISCrsSelectionDialog::onSearchTextChanged(const QString &text)
 {
-    for (int i = 0; i < d->crsList->count(); ++i) {
-        QListWidgetItem *item = d->crsList->item(i);
-        bool visible = text.isEmpty() || 
-                      item->text().contains(text, Qt::CaseInsensitive);
-        item->setHidden(!visible);
-    }
+    d->crsModel->setFilterText(text);
 }
 
 void HGISCrsSelectionDialog::onCrsSelectionChanged()
 {
-    QListWidgetItem *current = d->crsList->currentItem();
-    if (!current) {
+    QModelIndex current = d->crsList->currentIndex();
+    if (!current.isValid()) {
         d->detailsEdit->clear();
         return;
     }
     
-    int epsg = current->data(Qt::UserRole).toInt();
-    QString name = current->data(Qt::UserRole + 1).toString();
-    QString description = current->data(Qt::UserRole + 2).toString();
+    int epsg = current.data(HGISCrsListModel::EpsgRole).toInt();
+    if (epsg == d->selectedCrs.epsgCode() && !d->detailsEdit->toPlainText().isEmpty()) {
+        return;
+    }
+    QString name = current.data(HGISCrsListModel::NameRole).toString();
+    QString description = current.data(HGISCrsListModel::DescriptionRole).toString();
     
     // CRS 생성 및 상세 정보 표시
     HGISCoordinateReferenceSystem crs(epsg);
@@ -228,14 +213,7 @@ void HGISCrsSelectionDialog::setCurrentCrs(const HGISCoordinateReferenceSystem &
     d->selectedCrs = crs;
     
     // 목록에서 해당 CRS 선택
-    int epsg = crs.epsgCode();
-    for (int i = 0; i < d->crsList->count(); ++i) {
-        QListWidgetItem *item = d->crsList->item(i);
-        if (item->data(Qt::UserRole).toInt() == epsg) {
-            d->crsList->setCurrentItem(item);
-            break;
-        }
-    }
+    selectEpsg(crs.epsgCode());
 }
 
 void HGISCrsSelectionDialog::onKoreaCrsButtonClicked()
@@ -5,7 +5,8 @@
 #include <memory>
 #include "core/HGISCoordinateReferenceSystem.h"
 
-class QListWidget;
+class QListView;
+class HGISCrsListModel;
 class QLineEdit;
 class QTextEdit;
 class QPushButton;
@@ -32,7 +33,7 @@ private slots:
 private:
     void setupUi();
     void populateCrsList();
-    void addCrsItem(int epsg, const QString &name, const QString &description);
+    void selectEpsg(int epsg);
     
     class Private;
     std::unique_ptr<Private> d;
@@ -1,4 +1,5 @@
 #include "HGISMainWindow.h"
+#include "HGISAttributeTableModel.h"
 #include "HGISCrsSelectionDialog.h"
 #include "HGISMapCanvas.h"
 #include "core/HGISLayerManager.h"
@@ -16,11 +17,17 @@
 #include <QTextEdit>
 #include <QListWidget>
 #include <QTreeWidget>
+#include <QTableView>
+#include <QHeaderView>
+#include <QItemSelectionModel>
 #include <QSettings>
 #include <QCloseEvent>
 #include <QMessageBox>
 #include <QFileDialog>
+#include <QInputDialog>
 #include <QLabel>
+#include <QLineEdit>
+#include <QElapsedTimer>
 #include <QDebug>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
@@ -32,6 +39,8 @@
 #include <QGraphicsLineItem>
 #include <QGraphicsPathItem>
 #include <QPainterPath>
+#include <algorithm>
+#include <limits>
 
 class HGISMainWindow::Private
 {
@@ -50,6 +59,10 @@ public:
     QToolBar *fileToolBar = nullptr;
     QToolBar *editToolBar = nullptr;
     QToolBar *navigationToolBar = nullptr;
+    QToolBar *searchToolBar = nullptr;
+    
+    // 피처 검색
+    QLineEdit *searchEdit = nullptr;
     
     QAction *newProjectAct = nullptr;
     QAction *openProjectAct = nullptr;
@@ -57,6 +70,8 @@ public:
     QAction *saveProjectAsAct = nullptr;
     QAction *exitAct = nullptr;
     QAction *openShapefileAct = nullptr;
+    QAction *attributeTableAct = nullptr;
+    QAction *joinTableAct = nullptr;
     QAction *aboutAct = nullptr;
     QAction *aboutQtAct = nullptr;
     
@@ -72,10 +87,12 @@ public:
     QDockWidget *layersDock = nullptr;
     QDockWidget *browserDock = nullptr;
     QDockWidget *propertiesDock = nullptr;
+    QDockWidget *attributeDock = nullptr;
     
     QTreeWidget *layersTree = nullptr;
     QListWidget *browserList = nullptr;
     QTextEdit *propertiesEdit = nullptr;
+    QTableView *attributeView = nullptr;
     
     QLabel *coordinateLabel = nullptr;
     QLabel *scaleLabel = nullptr;
@@ -176,6 +193,16 @@ void HGISMainWindow::createActions()
     d->openShapefileAct->setStatusTip("Shapefile을 불러옵니다");
     connect(d->openShapefileAct, &QAction::triggered, this, &HGISMainWindow::openShapefile);
     
+    // 속성 테이블 액션
+    d->attributeTableAct = new QAction("속성 테이블 열기(&T)", this);
+    d->attributeTableAct->setShortcut(Qt::Key_F6);
+    d->attributeTableAct->setStatusTip("선택한 레이어의 속성 테이블을 엽니다");
+    connect(d->attributeTableAct, &QAction::triggered, this, &HGISMainWindow::openAttributeTable);
+    
+    d->joinTableAct = new QAction("표 조인(&J)...", this);
+    d->joinTableAct->setStatusTip("CSV/Excel 표의 필드를 키 필드로 레이어에 조인합니다");
+    connect(d->joinTableAct, &QAction::triggered, this, &HGISMainWindow::joinAttributeTable);
+    
     // 줌 액션들
     d->zoomInAct = new QAction("확대(&+)", this);
     d->zoomInAct->setShortcut(QKeySequence::ZoomIn);
@@ -228,6 +255,8 @@ void HGISMainWindow::createMenus()
     d->viewMenu->addSeparator();
     
     d->layerMenu = menuBar()->addMenu("레이어(&L)");
+    d->layerMenu->addAction(d->attributeTableAct);
+    d->layerMenu->addAction(d->joinTableAct);
     
     d->settingsMenu = menuBar()->addMenu("설정(&S)");
     d->settingsMenu->addAction(d->selectCrsAct);
@@ -253,6 +282,17 @@ void HGISMainWindow::createToolBars()
     d->navigationToolBar->addAction(d->zoomInAct);
     d->navigationToolBar->addAction(d->zoomOutAct);
     d->navigationToolBar->addAction(d->zoomFullAct);
+    
+    // 피처 검색 (속성 전체 텍스트, 초성 검색 지원)
+    d->searchToolBar = addToolBar("검색");
+    d->searchToolBar->setMovable(false);
+    d->searchEdit = new QLineEdit();
+    d->searchEdit->setPlaceholderText("피처 검색 (예: 고분, ㄱㅂ)");
+    d->searchEdit->setClearButtonEnabled(true);
+    d->searchEdit->setMaximumWidth(260);
+    d->searchEdit->setStatusTip("문자열 속성에서 검색하고 결과를 선택해 확대합니다");
+    connect(d->searchEdit, &QLineEdit::returnPressed, this, &HGISMainWindow::searchFeatures);
+    d->searchToolBar->addWidget(d->searchEdit);
 }
 
 void HGISMainWindow::createStatusBar()
@@ -463,20 +503,20 @@ void HGISMainWindow::openShapefile()
             symbol.strokeColor = Qt::darkBlue;
             symbol.pointSize = 5.0;
             break;
-            
+        
         case HGISGeometryType::LineString:
         case HGISGeometryType::MultiLineString:
             symbol.strokeColor = Qt::darkGreen;
             symbol.strokeWidth = 2.0;
             break;
-            
+        
         case HGISGeometryType::Polygon:
         case HGISGeometryType::MultiPolygon:
             symbol.fillColor = QColor(100, 150, 200, 100);
             symbol.strokeColor = Qt::darkBlue;
             symbol.strokeWidth = 1.5;
             break;
-            
+        
         default:
             break;
     }
@@ -485,6 +525,14 @@ void HGISMainWindow::openShapefile()
     // 레이어 매니저에 추가
     d->layerManager->addLayer(layer);
     
+    // 검색 색인은 백그라운드에서 생성
+    connect(layer->textSearchIndex(), &HGISTextSearchIndex::ready, this, [this, layer]() {
+        statusBar()->showMessage(QString("검색 색인 준비 완료: %1 (%2개 피처)")
+            .arg(layer->name())
+            .arg(layer->textSearchIndex()->documentCount()), 3000);
+    });
+    layer->buildTextSearchIndex();
+    
     // 전체 범위로 확대/축소
     d->mapCanvas->zoomToFullExtent();
     
@@ -521,4 +569,222 @@ void HGISMainWindow::openShapefile()
     statusBar()->showMessage(QString("Shapefile을 열었습니다: %1 (%2개 피처)")
         .arg(QFileInfo(fileName).fileName())
         .arg(layer->featureCount()), 3000);
-}
\ No newline at end of file
+}
+
+void HGISMainWindow::searchFeatures()
+{
+    const QString query = d->searchEdit->text().trimmed();
+    if (query.isEmpty()) {
+        return;
+    }
+    
+    QElapsedTimer timer;
+    timer.start();
+    
+    // 결과 범위 (지도 좌표계) - 점 하나도 포함되도록 좌표로 누적
+    double minX = std::numeric_limits<double>::max();
+    double minY = std::numeric_limits<double>::max();
+    double maxX = -std::numeric_limits<double>::max();
+    double maxY = -std::numeric_limits<double>::max();
+    
+    int matchCount = 0;
+    int pendingLayers = 0;
+    const HGISCoordinateReferenceSystem canvasCrs = d->mapCanvas->crs();
+    
+    for (HGISVectorLayer *layer : d->layerManager->vectorLayers()) {
+        if (!layer->textSearchIndex()->isReady()) {
+            ++pendingLayers;
+            layer->searchText(query);   // 생성이 시작되지 않았으면 시작
+            continue;
+        }
+        
+        const QVector<long> ids = layer->searchText(query);
+        QSet<long> selection;
+        selection.reserve(ids.size());
+        for (long id : ids) {
+            selection.insert(id);
+        }
+        layer->selectFeatures(selection);
+        
+        if (ids.isEmpty()) {
+            continue;
+        }
+        matchCount += ids.size();
+        
+        QRectF extent = layer->featuresExtent(ids);
+        if (extent.isNull() && extent.topLeft().isNull()) {
+            continue;
+        }
+        if (layer->crs().isValid() && canvasCrs.isValid() && layer->crs() != canvasCrs) {
+            HGISCoordinateTransform transform(layer->crs(), canvasCrs);
+            if (extent.isNull()) {
+                // 점 하나 - 범위 변환은 빈 사각형을 그대로 돌려주므로 점으로 변환
+                const QPointF point = transform.transform(extent.topLeft());
+                extent = QRectF(point, point);
+            } else {
+                extent = transform.transformBoundingBox(extent);
+                if (extent.isNull()) {
+                    continue;   // 변환 실패 - 원점이 결과 범위에 섞이지 않도록 건너뜀
+                }
+            }
+        }
+        minX = std::min(minX, extent.left());
+        minY = std::min(minY, extent.top());
+        maxX = std::max(maxX, extent.right());
+        maxY = std::max(maxY, extent.bottom());
+    }
+    
+    if (minX <= maxX) {
+        // 여백 10%, 점 하나만 찾았을 때도 주변이 보이도록 최소 여백 적용
+        const double minimumMargin = canvasCrs.isGeographic() ? 0.001 : 100.0;
+        const double margin = std::max(std::max(maxX - minX, maxY - minY) * 0.1, minimumMargin);
+        d->mapCanvas->setExtent(QRectF(QPointF(minX - margin, minY - margin),
+                                       QPointF(maxX + margin, maxY + margin)));
+    }
+    
+    QString message = QString("검색 \"%1\": %2건 (%3 ms)")
+        .arg(query)
+        .arg(matchCount)
+        .arg(timer.elapsed());
+    if (pendingLayers > 0) {
+        message += QString(" - 검색 색인 생성 중인 레이어 %1개").arg(pendingLayers);
+    }
+    qInfo() << message;
+    statusBar()->showMessage(message, 5000);
+}
+
+void HGISMainWindow::openAttributeTable()
+{
+    HGISVectorLayer *layer = currentVectorLayer();
+    if (!layer) {
+        statusBar()->showMessage("속성 테이블을 열 벡터 레이어가 없습니다", 3000);
+        return;
+    }
+    
+    if (!d->attributeDock) {
+        d->attributeDock = new QDockWidget("속성 테이블", this);
+        d->attributeDock->setAllowedAreas(Qt::BottomDockWidgetArea | Qt::TopDockWidgetArea);
+        d->attributeView = new QTableView();
+        d->attributeView->setSelectionBehavior(QAbstractItemView::SelectRows);
+        d->attributeView->setAlternatingRowColors(true);
+        d->attributeView->setWordWrap(false);
+        d->attributeView->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+        d->attributeView->verticalHeader()->setDefaultSectionSize(
+            d->attributeView->fontMetrics().height() + 6);
+        d->attributeDock->setWidget(d->attributeView);
+        addDockWidget(Qt::BottomDockWidgetArea, d->attributeDock);
+        d->viewMenu->addAction(d->attributeDock->toggleViewAction());
+    }
+    
+    QElapsedTimer timer;
+    timer.start();
+    
+    // 이전 모델 교체 (행은 화면에 보이는 페이지만 읽음)
+    QAbstractItemModel *oldModel = d->attributeView->model();
+    HGISAttributeTableModel *model = new HGISAttributeTableModel(layer, d->attributeView);
+    
+    // 정렬 표시를 비워 두고 정렬을 켜야 열자마자 색인을 만들지 않음
+    d->attributeView->setSortingEnabled(false);
+    d->attributeView->setModel(model);
+    d->attributeView->horizontalHeader()->setSortIndicator(-1, Qt::AscendingOrder);
+    d->attributeView->setSortingEnabled(true);
+    delete oldModel;
+    
+    // 표에서 선택한 행 -> 레이어 선택
+    auto syncing = std::make_shared<bool>(false);
+    connect(d->attributeView->selectionModel(), &QItemSelectionModel::selectionChanged, model,
+            [model, syncing, view = d->attributeView]() {
+        if (*syncing || !model->layer()) {
+            return;
+        }
+        QSet<long> ids;
+        for (const QItemSelectionRange &range : view->selectionModel()->selection()) {
+            for (int row = range.top(); row <= range.bottom(); ++row) {
+                const long id = model->featureId(row);
+                if (id >= 0) {
+                    ids.insert(id);
+                }
+            }
+        }
+        *syncing = true;
+        model->layer()->selectFeatures(ids);
+        *syncing = false;
+    });
+    
+    // 지도나 검색에서 선택이 바뀌면 표의 행 선택은 풀고 강조 색으로만 표시
+    connect(layer, &HGISVectorLayer::selectionChanged, model, [syncing, view = d->attributeView]() {
+        if (*syncing) {
+            return;
+        }
+        *syncing = true;
+        view->clearSelection();
+        *syncing = false;
+    });
+    
+    d->attributeDock->setWindowTitle(QString("속성 테이블 - %1 (%2개 피처)")
+        .arg(layer->name())
+        .arg(layer->featureCount()));
+    d->attributeDock->show();
+    d->attributeDock->raise();
+    
+    qInfo() << "속성 테이블 열기:" << layer->name() << timer.elapsed() << "ms";
+}
+
+HGISVectorLayer* HGISMainWindow::currentVectorLayer() const
+{
+    // 레이어 목록에서 선택한 레이어, 없으면 마지막으로 추가한 벡터 레이어
+    HGISVectorLayer *layer = nullptr;
+    if (QTreeWidgetItem *item = d->layersTree->currentItem()) {
+        layer = qobject_cast<HGISVectorLayer *>(d->layerManager->layerByName(item->text(0)));
+    }
+    if (!layer && !d->layerManager->vectorLayers().isEmpty()) {
+        layer = d->layerManager->vectorLayers().last();
+    }
+    return layer;
+}
+
+void HGISMainWindow::joinAttributeTable()
+{
+    HGISVectorLayer *layer = currentVectorLayer();
+    if (!layer) {
+        statusBar()->showMessage("조인할 벡터 레이어가 없습니다", 3000);
+        return;
+    }
+    
+    const QString tablePath = QFileDialog::getOpenFileName(this, "조인할 표 선택", "",
+        "표 (*.csv *.xlsx *.xls *.ods);;모든 파일 (*.*)");
+    if (tablePath.isEmpty()) {
+        return;
+    }
+    
+    bool ok = false;
+    const QStringList layerFields = layer->dataProvider() ? layer->dataProvider()->fields() : QStringList();
+    const QString targetField = QInputDialog::getItem(this, "표 조인",
+        QString("%1 레이어의 키 필드:").arg(layer->name()), layerFields, 0, false, &ok);
+    if (!ok || targetField.isEmpty()) {
+        return;
+    }
+    
+    const QString joinField = QInputDialog::getText(this, "표 조인",
+        QString("%1 표의 키 필드:").arg(QFileInfo(tablePath).fileName()),
+        QLineEdit::Normal, targetField, &ok);
+    if (!ok || joinField.isEmpty()) {
+        return;
+    }
+    
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    QElapsedTimer timer;
+    timer.start();
+    const bool joined = layer->addJoin(targetField, tablePath, joinField);
+    QApplication::restoreOverrideCursor();
+    
+    if (!joined) {
+        QMessageBox::warning(this, "표 조인",
+            QString("표를 조인할 수 없습니다:\n%1").arg(tablePath));
+        return;
+    }
+    
+    statusBar()->showMessage(QString("표를 조인했습니다: %1 (%2 ms)")
+        .arg(QFileInfo(tablePath).fileName())
+        .arg(timer.elapsed()), 5000);
+}
@@ -15,6 +15,7 @@ class QMenu;
 class QToolBar;
 class QStatusBar;
 class QDockWidget;
+class HGISVectorLayer;
 
 class GUI_EXPORT HGISMainWindow : public QMainWindow
 {
@@ -34,6 +35,9 @@ private slots:
     void saveProjectAs();
     void openShapefile();
     void selectProjectCrs();
+    void searchFeatures();
+    void openAttributeTable();
+    void joinAttributeTable();
     void about();
     void aboutQt();
     
@@ -46,6 +50,7 @@ private:
     void createDockWindows();
     void readSettings();
     void writeSettings();
+    HGISVectorLayer* currentVectorLayer() const;
     
     class Private;
     std::unique_ptr<Private> d;
@@ -275,6 +275,10 @@ void HGISMapCanvas::paintEvent(QPaintEvent *event)
     for (int i = layers.size() - 1; i >= 0; --i) {
         HGISMapLayer *layer = layers[i];
         if (layer && layer->isVisible()) {
+            // 캔버스 좌표계로 실시간 재투영
+            if (HGISVectorLayer *vectorLayer = qobject_cast<HGISVectorLayer*>(layer)) {
+                vectorLayer->setRenderCrs(d->crs);
+            }
             layer->render(&painter, d->mapExtent, d->mapScale);
         }
     }
@@ -6,6 +6,9 @@
 #include <ogr_srs_api.h>
 #include <cpl_conv.h>
 #include <cpl_string.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 class HGISGdalProvider::Private
 {
@@ -125,6 +128,164 @@ public:
         
         return true;
     }
+    
+    // SQL 식별자 인용 ("이름", 내부 큰따옴표는 두 번)
+    static QString quoteIdentifier(const QString &name)
+    {
+        QString escaped = name;
+        escaped.replace('"', "\"\"");
+        return '"' + escaped + '"';
+    }
+    
+    // 집계 대상 (maxFeatures가 있으면 앞쪽 피처만 - 스트리밍 경로와 같은 표본)
+    QString aggregateSource(long maxFeatures) const
+    {
+        const QString table = quoteIdentifier(layerName);
+        if (maxFeatures <= 0) {
+            return table;
+        }
+        return "(SELECT * FROM " + table + " LIMIT " + QString::number(maxFeatures) + ")";
+    }
+    
+    bool isNumericField(const QString &fieldName) const
+    {
+        OGRFeatureDefnH defn = OGR_L_GetLayerDefn(layer);
+        int index = OGR_FD_GetFieldIndex(defn, fieldName.toUtf8().constData());
+        if (index < 0) {
+            return false;
+        }
+        OGRFieldType type = OGR_Fld_GetType(OGR_FD_GetFieldDefn(defn, index));
+        return type == OFTInteger || type == OFTInteger64 || type == OFTReal;
+    }
+    
+    // 데이터베이스에 SQL을 그대로 전달하고 결과 행마다 콜백 호출
+    bool executeSql(const QString &sql, const std::function<void(OGRFeatureH row)> &callback)
+    {
+        OGRLayerH resultSet = GDALDatasetExecuteSQL(dataset, sql.toUtf8().constData(), nullptr, nullptr);
+        if (!resultSet) {
+            errorMessage = QString("SQL 실행 실패: %1").arg(QString::fromUtf8(CPLGetLastErrorMsg()));
+            qWarning() << errorMessage << sql;
+            return false;
+        }
+        
+        OGRFeatureH row;
+        while ((row = OGR_L_GetNextFeature(resultSet)) != nullptr) {
+            callback(row);
+            OGR_F_Destroy(row);
+        }
+        
+        GDALDatasetReleaseResultSet(dataset, resultSet);
+        return true;
+    }
+    
+    // 피처 변환에 쓰는 필드 정의 (여러 피처를 읽는 동안 한 번만 만들어 재사용)
+    struct FieldSchema {
+        std::vector<int> order;             // 필드 이름 순서의 필드 번호 (QMap 끝에 차례로 추가)
+        std::vector<OGRFieldType> types;    // 필드 번호 순서
+    };
+    
+    FieldSchema fieldSchema() const
+    {
+        FieldSchema schema;
+        OGRFeatureDefnH featureDefn = OGR_L_GetLayerDefn(layer);
+        const int fieldCount = OGR_FD_GetFieldCount(featureDefn);
+        schema.types.reserve(static_cast<std::size_t>(fieldCount));
+        for (int i = 0; i < fieldCount; i++) {
+            schema.types.push_back(OGR_Fld_GetType(OGR_FD_GetFieldDefn(featureDefn, i)));
+            schema.order.push_back(i);
+        }
+        std::sort(schema.order.begin(), schema.order.end(), [this](int a, int b) {
+            return fieldNames.value(a) < fieldNames.value(b);
+        });
+        return schema;
+    }
+    
+    // 링/라인 좌표를 한 번에 할당해 복사 (점마다 push_back 하거나 OGR_G_GetX를 부르지 않음)
+    static void readPoints(OGRGeometryH ring, std::vector<QPointF> &points)
+    {
+        const int pointCount = OGR_G_GetPointCount(ring);
+        if (pointCount <= 0) {
+            return;
+        }
+        points.resize(static_cast<std::size_t>(pointCount));
+        if (sizeof(qreal) == sizeof(double)) {
+            // QPointF는 (x, y) double 쌍이므로 간격을 주고 바로 채움
+            OGR_G_GetPoints(ring,
+                            reinterpret_cast<double *>(&points[0].rx()), sizeof(QPointF),
+                            reinterpret_cast<double *>(&points[0].ry()), sizeof(QPointF),
+                            nullptr, 0);
+        } else {
+            for (int i = 0; i < pointCount; i++) {
+                points[static_cast<std::size_t>(i)] = QPointF(OGR_G_GetX(ring, i), OGR_G_GetY(ring, i));
+            }
+        }
+    }
+    
+    // OGR 피처를 Feature 구조로 변환 (소유권은 호출자에게 남음)
+    // 필드 이름과 지오메트리 타입 문자열은 피처마다 만들지 않고 메타데이터의 것을 공유
+    Feature toFeature(OGRFeatureH feature, const FieldSchema &schema) const
+    {
+        Feature f;
+        f.id = OGR_F_GetFID(feature);
+        f.geometryType = geomType;
+        
+        // 속성 읽기 (이름 순서로 넣으므로 QMap이 자리를 찾지 않고 끝에 붙임)
+        for (int i : schema.order) {
+            if (!OGR_F_IsFieldSet(feature, i)) {
+                continue;
+            }
+            
+            QVariant value;
+            switch (schema.types[static_cast<std::size_t>(i)]) {
+                case OFTInteger:
+                    value = OGR_F_GetFieldAsInteger(feature, i);
+                    break;
+                case OFTInteger64:
+                    value = static_cast<qint64>(OGR_F_GetFieldAsInteger64(feature, i));
+                    break;
+                case OFTReal:
+                    value = OGR_F_GetFieldAsDouble(feature, i);
+                    break;
+                default:
+                    value = QString::fromUtf8(OGR_F_GetFieldAsString(feature, i));
+            }
+            f.attributes.insert(f.attributes.constEnd(), fieldNames[i], value);
+        }
+        
+        // 지오메트리 읽기
+        OGRGeometryH geometry = OGR_F_GetGeometryRef(feature);
+        if (geometry) {
+            OGRwkbGeometryType geomType = OGR_G_GetGeometryType(geometry);
+            
+            if (wkbFlatten(geomType) == wkbPoint) {
+                f.geometry.assign(1, QPointF(OGR_G_GetX(geometry, 0), OGR_G_GetY(geometry, 0)));
+            } else if (wkbFlatten(geomType) == wkbLineString) {
+                readPoints(geometry, f.geometry);
+            } else if (wkbFlatten(geomType) == wkbPolygon) {
+                readPoints(OGR_G_GetGeometryRef(geometry, 0), f.geometry); // 외부 링만
+            }
+        }
+        
+        return f;
+    }
+    
+    Feature toFeature(OGRFeatureH feature) const
+    {
+        return toFeature(feature, fieldSchema());
+    }
+    
+    // 지오메트리 읽기 생략 (속성만 필요할 때 디코딩 비용 절약)
+    void setGeometryIgnored(bool ignored)
+    {
+        const char *geometryOnly[] = {"OGR_GEOMETRY", nullptr};
+        OGR_L_SetIgnoredFields(layer, ignored ? geometryOnly : nullptr);
+    }
+    
+    static double doubleOrNaN(OGRFeatureH row, int index)
+    {
+        return OGR_F_IsFieldSetAndNotNull(row, index) ? OGR_F_GetFieldAsDouble(row, index)
+                                                      : std::numeric_limits<double>::quiet_NaN();
+    }
 };
 
 HGISGdalProvider::HGISGdalProvider(const QString &uri)
@@ -199,6 +360,11 @@ bool HGISGdalProvider::isValid() const
     return d->isValid;
 }
 
+QString HGISGdalProvider::uri() const
+{
+    return d->uri;
+}
+
 QString HGISGdalProvider::layerName() const
 {
     return d->layerName;
@@ -245,74 +411,137 @@ std::vector<HGISGdalProvider::Feature> HGISGdalProvider::readFeatures() const
     // 레이어 리셋
     OGR_L_ResetReading(d->layer);
     
+    // 공간 필터가 없으면 피처 수를 알고 있으므로 목록을 한 번에 할당
+    if (!OGR_L_GetSpatialFilter(d->layer) && d->featureCount > 0) {
+        features.reserve(static_cast<std::size_t>(d->featureCount));
+    }
+    
+    const Private::FieldSchema schema = d->fieldSchema();
     OGRFeatureH feature;
     while ((feature = OGR_L_GetNextFeature(d->layer)) != nullptr) {
-        Feature f;
-        f.id = OGR_F_GetFID(feature);
-        f.geometryType = d->geomType;
-        
-        // 속성 읽기
-        OGRFeatureDefnH featureDefn = OGR_L_GetLayerDefn(d->layer);
-        int fieldCount = OGR_FD_GetFieldCount(featureDefn);
-        
-        for (int i = 0; i < fieldCount; i++) {
-            OGRFieldDefnH fieldDefn = OGR_FD_GetFieldDefn(featureDefn, i);
-            QString fieldName = QString::fromUtf8(OGR_Fld_GetNameRef(fieldDefn));
-            
-            if (OGR_F_IsFieldSet(feature, i)) {
-                OGRFieldType fieldType = OGR_Fld_GetType(fieldDefn);
-                QVariant value;
-                
-                switch (fieldType) {
-                    case OFTInteger:
-                        value = OGR_F_GetFieldAsInteger(feature, i);
-                        break;
-                    case OFTInteger64:
-                        value = static_cast<qint64>(OGR_F_GetFieldAsInteger64(feature, i));
-                        break;
-                    case OFTReal:
-                        value = OGR_F_GetFieldAsDouble(feature, i);
-                        break;
-                    case OFTString:
-                        value = QString::fromUtf8(OGR_F_GetFieldAsString(feature, i));
-                        break;
-                    default:
-                        value = QString::fromUtf8(OGR_F_GetFieldAsString(feature, i));
-                }
-                
-                f.attributes[fieldName] = value;
-            }
-        }
-        
-        // 지오메트리 읽기
-        OGRGeometryH geometry = OGR_F_GetGeometryRef(feature);
-        if (geometry) {
-            OGRwkbGeometryType geomType = OGR_G_GetGeometryType(geometry);
-            
-            if (wkbFlatten(geomType) == wkbPoint) {
-                double x = OGR_G_GetX(geometry, 0);
-                double y = OGR_G_GetY(geometry, 0);
-                f.geometry.push_back(QPointF(x, y));
-            } else if (wkbFlatten(geomType) == wkbLineString || 
-                      wkbFlatten(geomType) == wkbPolygon) {
-                OGRGeometryH ring = geometry;
-                if (wkbFlatten(geomType) == wkbPolygon) {
-                    ring = OGR_G_GetGeometryRef(geometry, 0); // 외부 링만
-                }
-                
-                int pointCount = OGR_G_GetPointCount(ring);
-                for (int i = 0; i < pointCount; i++) {
-                    double x = OGR_G_GetX(ring, i);
-                    double y = OGR_G_GetY(ring, i);
-                    f.geometry.push_back(QPointF(x, y));
-                }
-            }
+        features.push_back(d->toFeature(feature, schema));
+        OGR_F_Destroy(feature);
+    }
+    
+    return features;
+}
+
+bool HGISGdalProvider::readFeature(long fid, Feature &feature) const
+{
+    if (!d->isValid || !d->layer) {
+        return false;
+    }
+    
+    OGRFeatureH ogrFeature = OGR_L_GetFeature(d->layer, fid);
+    if (!ogrFeature) {
+        return false;
+    }
+    
+    feature = d->toFeature(ogrFeature);
+    OGR_F_Destroy(ogrFeature);
+    return true;
+}
+
+std::vector<HGISGdalProvider::Feature> HGISGdalProvider::readFeaturePage(long offset, int count,
+                                                                        bool includeGeometry) const
+{
+    std::vector<Feature> features;
+    
+    if (!d->isValid || !d->layer || offset < 0 || count <= 0) {
+        return features;
+    }
+    
+    if (!includeGeometry) {
+        d->setGeometryIgnored(true);
+    }
+    
+    OGR_L_ResetReading(d->layer);
+    if (offset == 0 || OGR_L_SetNextByIndex(d->layer, offset) == OGRERR_NONE) {
+        features.reserve(static_cast<std::size_t>(count));
+        const Private::FieldSchema schema = d->fieldSchema();
+        OGRFeatureH feature;
+        while (static_cast<int>(features.size()) < count
+               && (feature = OGR_L_GetNextFeature(d->layer)) != nullptr) {
+            features.push_back(d->toFeature(feature, schema));
+            OGR_F_Destroy(feature);
         }
-        
-        features.push_back(f);
+    }
+    
+    if (!includeGeometry) {
+        d->setGeometryIgnored(false);
+    }
+    
+    return features;
+}
+
+std::vector<HGISGdalProvider::Feature> HGISGdalProvider::readFeaturesAfter(long afterFid, int count,
+                                                                          bool includeGeometry) const
+{
+    std::vector<Feature> features;
+    
+    if (!d->isValid || !d->layer || count <= 0) {
+        return features;
+    }
+    
+    // FID 조건은 SQLite 계열 드라이버에서 기본 키 탐색이 됨
+    const QByteArray filter = QString("FID > %1").arg(afterFid).toUtf8();
+    if (OGR_L_SetAttributeFilter(d->layer, filter.constData()) != OGRERR_NONE) {
+        return features;
+    }
+    if (!includeGeometry) {
+        d->setGeometryIgnored(true);
+    }
+    
+    OGR_L_ResetReading(d->layer);
+    features.reserve(static_cast<std::size_t>(count));
+    const Private::FieldSchema schema = d->fieldSchema();
+    OGRFeatureH feature;
+    while (static_cast<int>(features.size()) < count
+           && (feature = OGR_L_GetNextFeature(d->layer)) != nullptr) {
+        features.push_back(d->toFeature(feature, schema));
         OGR_F_Destroy(feature);
     }
     
+    if (!includeGeometry) {
+        d->setGeometryIgnored(false);
+    }
+    OGR_L_SetAttributeFilter(d->layer, nullptr);
+    
+    return features;
+}
+
+bool HGISGdalProvider::supportsFastPaging() const
+{
+    return d->isValid && d->layer && OGR_L_TestCapability(d->layer, OLCFastSetNextByIndex);
+}
+
+std::vector<HGISGdalProvider::Feature> HGISGdalProvider::readFeatures(const QVector<long> &fids,
+                                                                      bool includeGeometry) const
+{
+    std::vector<Feature> features;
+    
+    if (!d->isValid || !d->layer) {
+        return features;
+    }
+    
+    if (!includeGeometry) {
+        d->setGeometryIgnored(true);
+    }
+    
+    features.reserve(static_cast<std::size_t>(fids.size()));
+    const Private::FieldSchema schema = d->fieldSchema();
+    for (long fid : fids) {
+        OGRFeatureH feature = OGR_L_GetFeature(d->layer, fid);
+        if (feature) {
+            features.push_back(d->toFeature(feature, schema));
+            OGR_F_Destroy(feature);
+        }
+    }
+    
+    if (!includeGeometry) {
+        d->setGeometryIgnored(false);
+    }
+    
     return features;
 }
 
@@ -337,6 +566,227 @@ std::vector<HGISGdalProvider::Feature> HGISGdalProvider::readFeatures(const QRec
     return features;
 }
 
+long HGISGdalProvider::readFeatureBatches(std::size_t batchSize,
+                                          const std::function<bool(std::vector<OGRFeatureH> &batch)> &callback) const
+{
+    if (!d->isValid || !d->layer || batchSize == 0) {
+        return -1;
+    }
+    
+    OGR_L_ResetReading(d->layer);
+    
+    long count = 0;
+    std::vector<OGRFeatureH> batch;
+    batch.reserve(batchSize);
+    
+    OGRFeatureH feature;
+    while ((feature = OGR_L_GetNextFeature(d->layer)) != nullptr) {
+        batch.push_back(feature);
+        ++count;
+        
+        if (batch.size() == batchSize) {
+            bool keepReading = callback(batch);
+            batch.clear();
+            if (!keepReading) {
+                return count;
+            }
+        }
+    }
+    
+    if (!batch.empty()) {
+        callback(batch);
+    }
+    
+    return count;
+}
+
+OGRLayerH HGISGdalProvider::layerHandle() const
+{
+    return d->layer;
+}
+
+bool HGISGdalProvider::supportsAggregatePushdown() const
+{
+    if (!d->isValid || !d->dataset) {
+        return false;
+    }
+    
+    // SQL이 SQLite 엔진으로 직접 전달되는 드라이버만 (OGR SQL은 내부적으로 피처를 순회)
+    GDALDriverH driver = GDALGetDatasetDriver(d->dataset);
+    QString driverName = QString::fromUtf8(GDALGetDriverShortName(driver));
+    return driverName == "GPKG" || driverName == "SQLite";
+}
+
+bool HGISGdalProvider::aggregateFields(const QStringList &fieldNames, std::vector<FieldAggregate> &result,
+                                       long maxFeatures) const
+{
+    if (!supportsAggregatePushdown() || fieldNames.isEmpty()) {
+        return false;
+    }
+    
+    const QString source = d->aggregateSource(maxFeatures);
+    
+    // 모든 필드를 하나의 SELECT로 집계 (테이블 한 번 스캔)
+    // 필드마다 COUNT, COUNT(DISTINCT), MIN, MAX, SUM, AVG 6개 열
+    const int columnsPerField = 6;
+    QStringList columns;
+    columns << "COUNT(*)";
+    
+    result.assign(fieldNames.size(), FieldAggregate());
+    for (int i = 0; i < fieldNames.size(); ++i) {
+        const QString field = Private::quoteIdentifier(fieldNames[i]);
+        result[i].fieldName = fieldNames[i];
+        result[i].numeric = d->isNumericField(fieldNames[i]);
+        
+        columns << QString("COUNT(%1)").arg(field)
+                << QString("COUNT(DISTINCT %1)").arg(field);
+        if (result[i].numeric) {
+            columns << QString("MIN(%1)").arg(field)
+                    << QString("MAX(%1)").arg(field)
+                    << QString("SUM(%1)").arg(field)
+                    << QString("AVG(%1)").arg(field);
+        } else {
+            columns << "NULL" << "NULL" << "NULL" << "NULL";
+        }
+    }
+    
+    // 식별자에 '%'가 있어도 안전하도록 QString::arg 대신 연결
+    QString sql = "SELECT " + columns.join(", ") + " FROM " + source;
+    
+    bool gotRow = false;
+    bool ok = d->executeSql(sql, [&](OGRFeatureH row) {
+        gotRow = true;
+        const long total = static_cast<long>(OGR_F_GetFieldAsInteger64(row, 0));
+        
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            FieldAggregate &aggregate = result[i];
+            const int base = 1 + static_cast<int>(i) * columnsPerField;
+            
+            aggregate.count = static_cast<long>(OGR_F_GetFieldAsInteger64(row, base));
+            aggregate.nullCount = total - aggregate.count;
+            aggregate.distinctCount = static_cast<long>(OGR_F_GetFieldAsInteger64(row, base + 1));
+            
+            if (aggregate.numeric && aggregate.count > 0) {
+                aggregate.minimum = Private::doubleOrNaN(row, base + 2);
+                aggregate.maximum = Private::doubleOrNaN(row, base + 3);
+                aggregate.sum = Private::doubleOrNaN(row, base + 4);
+                aggregate.mean = Private::doubleOrNaN(row, base + 5);
+            } else {
+                aggregate.minimum = aggregate.maximum = std::numeric_limits<double>::quiet_NaN();
+                aggregate.mean = aggregate.stddev = std::numeric_limits<double>::quiet_NaN();
+                aggregate.sum = 0.0;
+            }
+        }
+    });
+    if (!ok || !gotRow) {
+        return false;
+    }
+    
+    // 분산은 첫 질의의 평균을 뺀 편차로 한 번 더 집계 (두 단계 보정 방식: E[d^2] - E[d]^2)
+    // E[x^2] - E[x]^2 는 TM 좌표나 긴 ID처럼 큰 값에서 상쇄 오차로 0이나 엉뚱한 값이 됨
+    QStringList deviations;
+    std::vector<std::size_t> numericFields;
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        if (!result[i].numeric || result[i].count <= 0 || std::isnan(result[i].mean)) {
+            continue;
+        }
+        const QString deviation = "(CAST(" + Private::quoteIdentifier(result[i].fieldName) + " AS REAL) - "
+                                  + QString::number(result[i].mean, 'g', 17) + ")";
+        deviations << "AVG(" + deviation + " * " + deviation + ")"
+                   << "AVG(" + deviation + ")";
+        numericFields.push_back(i);
+    }
+    if (numericFields.empty()) {
+        return true;
+    }
+    
+    sql = "SELECT " + deviations.join(", ") + " FROM " + source;
+    return d->executeSql(sql, [&](OGRFeatureH row) {
+        for (std::size_t k = 0; k < numericFields.size(); ++k) {
+            FieldAggregate &aggregate = result[numericFields[k]];
+            const double meanSquare = Private::doubleOrNaN(row, static_cast<int>(k) * 2);
+            const double meanDeviation = Private::doubleOrNaN(row, static_cast<int>(k) * 2 + 1);
+            aggregate.stddev = std::sqrt(std::max(0.0, meanSquare - meanDeviation * meanDeviation));
+        }
+    });
+}
+
+bool HGISGdalProvider::distinctValues(const QString &fieldName, QVariantList &values, long maxFeatures) const
+{
+    if (!supportsAggregatePushdown()) {
+        return false;
+    }
+    
+    const QString field = Private::quoteIdentifier(fieldName);
+    const bool numeric = d->isNumericField(fieldName);
+    QString sql = "SELECT DISTINCT " + field + " FROM " + d->aggregateSource(maxFeatures)
+                  + " WHERE " + field + " IS NOT NULL ORDER BY " + field;
+    
+    values.clear();
+    return d->executeSql(sql, [&](OGRFeatureH row) {
+        if (numeric) {
+            values.append(OGR_F_GetFieldAsDouble(row, 0));
+        } else {
+            values.append(QString::fromUtf8(OGR_F_GetFieldAsString(row, 0)));
+        }
+    });
+}
+
+bool HGISGdalProvider::mostFrequentValues(const QString &fieldName, int limit,
+                                          QVariantList &values, QVector<long> &counts,
+                                          long maxFeatures) const
+{
+    if (!supportsAggregatePushdown() || limit <= 0) {
+        return false;
+    }
+    
+    const QString field = Private::quoteIdentifier(fieldName);
+    const bool numeric = d->isNumericField(fieldName);
+    QString sql = "SELECT " + field + ", COUNT(*) AS frequency FROM " + d->aggregateSource(maxFeatures)
+                  + " WHERE " + field + " IS NOT NULL GROUP BY " + field
+                  + " ORDER BY frequency DESC LIMIT " + QString::number(limit);
+    
+    values.clear();
+    counts.clear();
+    return d->executeSql(sql, [&](OGRFeatureH row) {
+        if (numeric) {
+            values.append(OGR_F_GetFieldAsDouble(row, 0));
+        } else {
+            values.append(QString::fromUtf8(OGR_F_GetFieldAsString(row, 0)));
+        }
+        counts.append(static_cast<long>(OGR_F_GetFieldAsInteger64(row, 1)));
+    });
+}
+
+bool HGISGdalProvider::histogram(const QString &fieldName, double minimum, double maximum,
+                                 int bins, QVector<long> &counts, long maxFeatures) const
+{
+    if (!supportsAggregatePushdown() || bins <= 0 || !d->isNumericField(fieldName)) {
+        return false;
+    }
+    
+    const QString field = Private::quoteIdentifier(fieldName);
+    const double width = maximum - minimum;
+    
+    // 구간 번호 = min(floor((x - min) / 폭 * bins), bins - 1)
+    QString bin = width > 0
+        ? "MIN(CAST((" + field + " - " + QString::number(minimum, 'g', 17) + ") * "
+              + QString::number(bins) + " / " + QString::number(width, 'g', 17)
+              + " AS INTEGER), " + QString::number(bins - 1) + ")"
+        : QString("0");
+    
+    QString sql = "SELECT " + bin + " AS bin, COUNT(*) FROM " + d->aggregateSource(maxFeatures)
+                  + " WHERE " + field + " IS NOT NULL GROUP BY bin";
+    
+    counts.fill(0, bins);
+    return d->executeSql(sql, [&](OGRFeatureH row) {
+        int index = OGR_F_GetFieldAsInteger(row, 0);
+        if (index >= 0 && index < bins) {
+            counts[index] += static_cast<long>(OGR_F_GetFieldAsInteger64(row, 1));
+        }
+    });
+}
+
 QString HGISGdalProvider::errorMessage() const
 {
     return d->errorMessage;
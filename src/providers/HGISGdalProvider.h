@@ -5,6 +5,9 @@
 #include <QStringList>
 #include <QRectF>
 #include <QVariant>
+#include <QVector>
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -49,6 +52,12 @@ public:
      */
     bool isValid() const;
     
+    /**
+     * 데이터 소스 경로 반환
+     * @return 생성자에 전달한 경로
+     */
+    QString uri() const;
+    
     /**
      * 레이어 이름 반환
      * @return 레이어 이름
@@ -107,6 +116,45 @@ public:
      */
     std::vector<Feature> readFeatures() const;
     
+    /**
+     * FID로 피처 하나 읽기 (임의 접근)
+     * @param fid 피처 ID
+     * @param feature 읽은 피처
+     * @return 성공 여부 (없는 FID면 false)
+     */
+    bool readFeature(long fid, Feature &feature) const;
+    
+    /**
+     * 읽기 순서 기준으로 한 구간의 피처 읽기 (속성 테이블 페이지용)
+     * Shapefile처럼 임의 접근을 지원하는 드라이버는 앞부분을 읽지 않고 바로 이동
+     * @param offset 시작 위치 (FID가 아닌 읽기 순서, 0부터)
+     * @param count 최대 피처 수
+     * @param includeGeometry false면 지오메트리를 읽지 않음
+     * @return 피처 목록
+     */
+    std::vector<Feature> readFeaturePage(long offset, int count, bool includeGeometry = false) const;
+    
+    /**
+     * FID 순서로 afterFid 다음 피처부터 한 구간 읽기 (속성 테이블 페이지용)
+     * 임의 접근이 느린 드라이버 (GeoJSON, GeoPackage 등) 에서 앞부분을 다시 읽지 않도록 FID 조건으로 이동
+     * @param afterFid 이 FID보다 큰 피처부터 (처음부터면 -1)
+     * @param count 최대 피처 수
+     * @param includeGeometry false면 지오메트리를 읽지 않음
+     * @return 피처 목록
+     */
+    std::vector<Feature> readFeaturesAfter(long afterFid, int count, bool includeGeometry = false) const;
+    
+    // 읽기 순서 위치로 바로 이동할 수 있는지 (Shapefile 등, readFeaturePage가 앞부분을 읽지 않음)
+    bool supportsFastPaging() const;
+    
+    /**
+     * FID 목록의 피처 읽기 (임의 접근)
+     * @param fids 피처 ID 목록
+     * @param includeGeometry false면 지오메트리를 읽지 않음
+     * @return 피처 목록 (목록 순서 유지, 없는 FID는 건너뜀)
+     */
+    std::vector<Feature> readFeatures(const QVector<long> &fids, bool includeGeometry = false) const;
+    
     /**
      * 특정 범위의 피처 읽기
      * @param bounds 공간 범위
@@ -114,6 +162,90 @@ public:
      */
     std::vector<Feature> readFeatures(const QRectF &bounds) const;
     
+    /**
+     * 피처를 일정 개수씩 묶어 순차적으로 읽기 (전체를 메모리에 올리지 않음)
+     * 지오메트리를 그대로 보존해야 하는 변환/내보내기용 저수준 인터페이스
+     * @param batchSize 한 번에 전달할 피처 수
+     * @param callback 피처 묶음을 받는 함수. 피처 소유권이 넘어가므로
+     *                 OGR_F_Destroy로 해제해야 하며, false를 반환하면 읽기 중단
+     * @return 읽은 피처 수 (실패 시 -1)
+     */
+    long readFeatureBatches(std::size_t batchSize,
+                            const std::function<bool(std::vector<OGRFeatureH> &batch)> &callback) const;
+    
+    /**
+     * OGR 레이어 핸들 반환 (필드 정의 복사 등 저수준 접근용)
+     * @return 레이어 핸들 (열리지 않았으면 nullptr)
+     */
+    OGRLayerH layerHandle() const;
+    
+    /**
+     * 필드 집계 결과
+     */
+    struct FieldAggregate {
+        QString fieldName;                 // 필드 이름
+        bool numeric = false;              // 숫자 필드 여부 (아니면 최솟값~표준편차는 NaN)
+        long count = 0;                    // NULL이 아닌 값 수
+        long nullCount = 0;                // NULL 값 수
+        long distinctCount = 0;            // 고유값 수
+        double minimum = 0.0;              // 최솟값
+        double maximum = 0.0;              // 최댓값
+        double sum = 0.0;                  // 합계
+        double mean = 0.0;                 // 평균
+        double stddev = 0.0;               // 모표준편차
+    };
+    
+    /**
+     * SQL 집계 위임 가능 여부 (GeoPackage, SQLite)
+     * @return 데이터베이스가 직접 집계할 수 있는지 여부
+     */
+    bool supportsAggregatePushdown() const;
+    
+    /**
+     * 여러 필드의 집계를 한 번의 SQL 질의로 데이터베이스에서 계산
+     * (SELECT COUNT/MIN/MAX/SUM/AVG/COUNT(DISTINCT) ...)
+     * @param fieldNames 필드 이름 목록
+     * @param result 필드 순서대로 채워질 집계 결과
+     * @param maxFeatures 0보다 크면 앞쪽 피처만 집계 (표본)
+     * @return 성공 여부 (위임을 지원하지 않으면 false)
+     */
+    bool aggregateFields(const QStringList &fieldNames, std::vector<FieldAggregate> &result,
+                         long maxFeatures = 0) const;
+    
+    /**
+     * 필드의 고유값을 데이터베이스에서 정렬된 상태로 가져오기 (SELECT DISTINCT)
+     * @param fieldName 필드 이름
+     * @param values 고유값 목록 (숫자 필드는 double, 그 외는 문자열)
+     * @param maxFeatures 0보다 크면 앞쪽 피처만 (표본)
+     * @return 성공 여부
+     */
+    bool distinctValues(const QString &fieldName, QVariantList &values, long maxFeatures = 0) const;
+    
+    /**
+     * 빈도가 높은 값을 데이터베이스에서 가져오기 (GROUP BY ... ORDER BY COUNT(*) DESC LIMIT)
+     * @param fieldName 필드 이름
+     * @param limit 최대 개수
+     * @param values 값 목록 (빈도 내림차순)
+     * @param counts 값별 빈도
+     * @param maxFeatures 0보다 크면 앞쪽 피처만 (표본)
+     * @return 성공 여부
+     */
+    bool mostFrequentValues(const QString &fieldName, int limit,
+                            QVariantList &values, QVector<long> &counts, long maxFeatures = 0) const;
+    
+    /**
+     * 숫자 필드의 히스토그램을 데이터베이스에서 계산 (GROUP BY 구간)
+     * @param fieldName 필드 이름
+     * @param minimum 첫 구간 시작값
+     * @param maximum 마지막 구간 끝값 (마지막 구간에 포함)
+     * @param bins 구간 수
+     * @param counts 구간별 도수
+     * @param maxFeatures 0보다 크면 앞쪽 피처만 (표본)
+     * @return 성공 여부
+     */
+    bool histogram(const QString &fieldName, double minimum, double maximum,
+                   int bins, QVector<long> &counts, long maxFeatures = 0) const;
+    
     /**
      * 에러 메시지 반환
      * @return 마지막 에러 메시지
@@ -0,0 +1,238 @@
+// 네이티브 TM 커널과 PROJ 결과 비교 (허용 오차 1mm, 경위도 1e-8도)
+//
+// Korea 2000 (EPSG:5179, 5185~5188) 은 네이티브 커널을 쓰고 PROJ와 일치해야 하며,
+// Korean 1985 (EPSG:5174~5178) 는 데이텀 변환 단계가 있으므로 PROJ로 넘어가야 한다.
+
+#include <QtTest>
+#include <proj.h>
+#include <cmath>
+#include <vector>
+#include "core/HGISCoordinateReferenceSystem.h"
+#include "core/HGISCoordinateTransform.h"
+#include "core/HGISTransverseMercator.h"
+
+namespace
+{
+constexpr double kToleranceMeters = 1e-3;
+constexpr double kToleranceDegrees = 1e-8;
+constexpr double kDegToRad = M_PI / 180.0;
+
+// 한반도 주변 경위도 격자 (0.25도 간격)
+std::vector<QPointF> sampleGrid()
+{
+    std::vector<QPointF> points;
+    for (double lon = 124.0; lon <= 132.0; lon += 0.25) {
+        for (double lat = 33.0; lat <= 43.0; lat += 0.25) {
+            points.push_back(QPointF(lon, lat));
+        }
+    }
+    return points;
+}
+
+// EPSG:4326 -> 대상 좌표계 PROJ 변환 (경도, 위도 순서)
+class ProjTransform
+{
+public:
+    explicit ProjTransform(int epsgCode)
+    {
+        m_ctx = proj_context_create();
+        const QByteArray target = QString("EPSG:%1").arg(epsgCode).toUtf8();
+        PJ *pj = proj_create_crs_to_crs(m_ctx, "EPSG:4326", target.constData(), nullptr);
+        if (pj) {
+            m_pj = proj_normalize_for_visualization(m_ctx, pj);
+            proj_destroy(pj);
+        }
+    }
+    
+    ~ProjTransform()
+    {
+        if (m_pj) {
+            proj_destroy(m_pj);
+        }
+        proj_context_destroy(m_ctx);
+    }
+    
+    bool isValid() const { return m_pj != nullptr; }
+    
+    QPointF transform(const QPointF &point, bool reverse = false) const
+    {
+        PJ_COORD coord = proj_coord(point.x(), point.y(), 0.0, 0.0);
+        PJ_COORD result = proj_trans(m_pj, reverse ? PJ_INV : PJ_FWD, coord);
+        return QPointF(result.xy.x, result.xy.y);
+    }
+    
+private:
+    PJ_CONTEXT *m_ctx = nullptr;
+    PJ *m_pj = nullptr;
+};
+}
+
+class TestTransverseMercator : public QObject
+{
+    Q_OBJECT
+    
+private slots:
+    void kernelMatchesProj_data();
+    void kernelMatchesProj();
+    void pipelineMatchesProj_data();
+    void pipelineMatchesProj();
+    void nativeFailureReported();
+};
+
+void TestTransverseMercator::kernelMatchesProj_data()
+{
+    QTest::addColumn<int>("epsg");
+    QTest::addColumn<double>("lon0");
+    QTest::addColumn<double>("k0");
+    QTest::addColumn<double>("x0");
+    QTest::addColumn<double>("y0");
+    
+    QTest::newRow("EPSG:5179") << 5179 << 127.5 << 0.9996 << 1000000.0 << 2000000.0;
+    QTest::newRow("EPSG:5185") << 5185 << 125.0 << 1.0 << 200000.0 << 600000.0;
+    QTest::newRow("EPSG:5186") << 5186 << 127.0 << 1.0 << 200000.0 << 600000.0;
+    QTest::newRow("EPSG:5187") << 5187 << 129.0 << 1.0 << 200000.0 << 600000.0;
+    QTest::newRow("EPSG:5188") << 5188 << 131.0 << 1.0 << 200000.0 << 600000.0;
+}
+
+void TestTransverseMercator::kernelMatchesProj()
+{
+    QFETCH(int, epsg);
+    QFETCH(double, lon0);
+    QFETCH(double, k0);
+    QFETCH(double, x0);
+    QFETCH(double, y0);
+    
+    ProjTransform proj(epsg);
+    QVERIFY(proj.isValid());
+    
+    // GRS80, 원점 위도 38도
+    HGISTransverseMercator tm(6378137.0, 1.0 / 298.257222101, 38.0, lon0, k0, x0, y0);
+    QVERIFY(tm.isValid());
+    
+    const std::vector<QPointF> grid = sampleGrid();
+    std::vector<double> xs;
+    std::vector<double> ys;
+    for (const QPointF &point : grid) {
+        xs.push_back(point.x() * kDegToRad);
+        ys.push_back(point.y() * kDegToRad);
+    }
+    
+    // 정방향 (배열 커널)
+    tm.forward(xs.data(), ys.data(), xs.size());
+    for (std::size_t i = 0; i < grid.size(); ++i) {
+        const QPointF exact = proj.transform(grid[i]);
+        QVERIFY2(std::abs(xs[i] - exact.x()) <= kToleranceMeters
+                 && std::abs(ys[i] - exact.y()) <= kToleranceMeters,
+                 qPrintable(QString("정방향 %1, %2: %3, %4 (PROJ %5, %6)")
+                            .arg(grid[i].x()).arg(grid[i].y())
+                            .arg(xs[i], 0, 'f', 6).arg(ys[i], 0, 'f', 6)
+                            .arg(exact.x(), 0, 'f', 6).arg(exact.y(), 0, 'f', 6)));
+    }
+    
+    // 역방향 (PROJ 투영 좌표에서 출발)
+    std::vector<QPointF> projected;
+    for (std::size_t i = 0; i < grid.size(); ++i) {
+        projected.push_back(proj.transform(grid[i]));
+        xs[i] = projected[i].x();
+        ys[i] = projected[i].y();
+    }
+    tm.inverse(xs.data(), ys.data(), xs.size());
+    for (std::size_t i = 0; i < grid.size(); ++i) {
+        const QPointF exact = proj.transform(projected[i], true);
+        const double lon = xs[i] / kDegToRad;
+        const double lat = ys[i] / kDegToRad;
+        QVERIFY2(std::abs(lon - exact.x()) <= kToleranceDegrees
+                 && std::abs(lat - exact.y()) <= kToleranceDegrees,
+                 qPrintable(QString("역방향 %1, %2: %3, %4 (PROJ %5, %6)")
+                            .arg(projected[i].x(), 0, 'f', 3).arg(projected[i].y(), 0, 'f', 3)
+                            .arg(lon, 0, 'f', 10).arg(lat, 0, 'f', 10)
+                            .arg(exact.x(), 0, 'f', 10).arg(exact.y(), 0, 'f', 10)));
+    }
+    
+    // 단일 좌표 경로도 배열 커널과 같은 결과
+    double x, y;
+    tm.forward(127.0 * kDegToRad, 37.5 * kDegToRad, x, y);
+    const QPointF exact = proj.transform(QPointF(127.0, 37.5));
+    QVERIFY(std::abs(x - exact.x()) <= kToleranceMeters);
+    QVERIFY(std::abs(y - exact.y()) <= kToleranceMeters);
+}
+
+void TestTransverseMercator::pipelineMatchesProj_data()
+{
+    QTest::addColumn<int>("epsg");
+    QTest::addColumn<bool>("native");
+    
+    QTest::newRow("EPSG:5179") << 5179 << true;
+    QTest::newRow("EPSG:5185") << 5185 << true;
+    QTest::newRow("EPSG:5186") << 5186 << true;
+    QTest::newRow("EPSG:5187") << 5187 << true;
+    QTest::newRow("EPSG:5188") << 5188 << true;
+    
+    // Korean 1985 - 데이텀 변환 (Molodensky-Badekas) 단계가 있어 PROJ 사용
+    QTest::newRow("EPSG:5174") << 5174 << false;
+    QTest::newRow("EPSG:5175") << 5175 << false;
+    QTest::newRow("EPSG:5176") << 5176 << false;
+    QTest::newRow("EPSG:5177") << 5177 << false;
+    QTest::newRow("EPSG:5178") << 5178 << false;
+}
+
+void TestTransverseMercator::pipelineMatchesProj()
+{
+    QFETCH(int, epsg);
+    QFETCH(bool, native);
+    
+    ProjTransform proj(epsg);
+    QVERIFY(proj.isValid());
+    
+    HGISCoordinateTransform transform(HGISCoordinateReferenceSystem::wgs84(),
+                                      HGISCoordinateReferenceSystem(epsg));
+    QVERIFY(transform.isValid());
+    QCOMPARE(transform.usesNativeTransverseMercator(), native);
+    
+    const std::vector<QPointF> grid = sampleGrid();
+    std::vector<QPointF> points = grid;
+    QVERIFY(transform.transformCoordinates(&points.front().rx(), &points.front().ry(),
+                                           points.size(), 2));
+    for (std::size_t i = 0; i < grid.size(); ++i) {
+        const QPointF exact = proj.transform(grid[i]);
+        QVERIFY2(std::abs(points[i].x() - exact.x()) <= kToleranceMeters
+                 && std::abs(points[i].y() - exact.y()) <= kToleranceMeters,
+                 qPrintable(QString("정방향 %1, %2").arg(grid[i].x()).arg(grid[i].y())));
+    }
+    
+    // 역변환은 PROJ 투영 좌표에서 출발
+    std::vector<QPointF> projected;
+    for (const QPointF &point : grid) {
+        projected.push_back(proj.transform(point));
+    }
+    points = projected;
+    QVERIFY(transform.transformCoordinates(&points.front().rx(), &points.front().ry(),
+                                           points.size(), 2, true));
+    for (std::size_t i = 0; i < grid.size(); ++i) {
+        const QPointF exact = proj.transform(projected[i], true);
+        QVERIFY2(std::abs(points[i].x() - exact.x()) <= kToleranceDegrees
+                 && std::abs(points[i].y() - exact.y()) <= kToleranceDegrees,
+                 qPrintable(QString("역방향 %1, %2").arg(projected[i].x()).arg(projected[i].y())));
+    }
+}
+
+void TestTransverseMercator::nativeFailureReported()
+{
+    HGISCoordinateTransform transform(HGISCoordinateReferenceSystem::wgs84(),
+                                      HGISCoordinateReferenceSystem::korea2000Central());
+    QVERIFY(transform.usesNativeTransverseMercator());
+    
+    // 중앙자오선에서 90도를 넘는 경도는 TM 정의역 밖
+    double x[2] = {127.0, -60.0};
+    double y[2] = {37.5, 37.5};
+    QVERIFY(!transform.transformCoordinates(x, y, 2));
+    QVERIFY(std::isfinite(x[0]) && std::isfinite(y[0]));
+    QVERIFY(x[1] == HUGE_VAL);
+    QVERIFY(y[1] == HUGE_VAL);
+    
+    // 단일 좌표는 PROJ 경로와 같이 실패 시 원래 좌표 반환
+    QCOMPARE(transform.transform(QPointF(-60.0, 37.5)), QPointF(-60.0, 37.5));
+}
+
+QTEST_GUILESS_MAIN(TestTransverseMercator)
+#include "test_transversemercator.moc"